@@ -0,0 +1,151 @@
+#include "exchange_config.h"
+#include "level_store.h"
+#include "order_flow.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/*
+Replays one book's worth of stochastic order flow (the exchange's FLOW_MODEL=hawkes placement,
+sizes and mid drift) through each level store and reports the cost per event, including a Best()
+read after every event as the plant's top-of-book publishing does.
+
+The flow is read from the exchange's environment (PRICE_LEVELS, PRICE_TAIL_EXPONENT, MID_DRIFT_RATE,
+CHANCE_OF_ADD, CHANCE_OF_DELETE, ...). BENCH_EVENTS and BENCH_PASSES size the run.
+*/
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::vector<MarketEvent> GenerateFlow(const ExchangeConfig& config, std::size_t count) {
+    std::mt19937_64 generator(1);
+    std::uniform_int_distribution<int> chance(1, 100);
+    std::uniform_int_distribution<int> side_of(0, 1);
+    OrderFlowModel flow(config);
+
+    const std::size_t levels = static_cast<std::size_t>(std::max(config.price_levels, 3));
+    const Price tick_size = std::max<Price>(config.min_tick_size, 1);
+    auto to_price = [&](std::size_t tick) { return config.min_price + static_cast<Price>(tick) * tick_size; };
+
+    // Shadow book: resting quantity per tick and side, bids below the mid and asks above it
+    std::vector<Quantity> book[2] = {std::vector<Quantity>(levels), std::vector<Quantity>(levels)};
+    std::size_t active[2] = {0, 0};
+    std::size_t mid = levels / 2;
+
+    std::vector<MarketEvent> events;
+    events.reserve(count);
+
+    auto push = [&](Side side, LevelEvent event, std::size_t tick, Quantity quantity) {
+        MarketEvent e{};
+        e.instrument_id = 1;
+        e.side = side;
+        e.event = event;
+        e.price = to_price(tick);
+        e.quantity = quantity;
+        events.push_back(e);
+    };
+
+    auto remove = [&](Side side, std::size_t tick, Quantity quantity) {
+        const std::size_t s = static_cast<std::size_t>(side);
+        Quantity& level = book[s][tick];
+        quantity = std::min(quantity, level);
+        level -= quantity;
+        if (level == 0) --active[s];
+        push(side, LevelEvent::kModifyLevel, tick, quantity);
+    };
+
+    while (events.size() < count) {
+        if (const int move = flow.Drift(generator)) {
+            const std::size_t next = static_cast<std::size_t>(
+                std::clamp(static_cast<int>(mid) + move, 1, static_cast<int>(levels) - 2));
+            if (next != mid) {
+                mid = next;
+                const Side crossed = move > 0 ? Side::kAsk : Side::kBid;
+                if (const Quantity q = book[static_cast<std::size_t>(crossed)][mid]) remove(crossed, mid, q);
+            }
+        }
+
+        const Side side = static_cast<Side>(side_of(generator));
+        const std::size_t s = static_cast<std::size_t>(side);
+        const std::size_t max_distance = side == Side::kBid ? mid : levels - 1 - mid;
+        const std::size_t distance = flow.Distance(generator, max_distance);
+        const std::size_t tick = side == Side::kBid ? mid - distance : mid + distance;
+
+        if (active[s] == 0 || chance(generator) <= config.chance_of_add) {
+            const Quantity quantity = flow.Size(generator);
+            if (book[s][tick] == 0) ++active[s];
+            book[s][tick] += quantity;
+            push(side, LevelEvent::kAddLevel, tick, quantity);
+            continue;
+        }
+
+        // Reduce the resting level nearest the sampled placement, searching away from the mid first
+        std::size_t found = levels;
+        for (std::size_t d = 0; d < levels && found == levels; ++d) {
+            if (tick + d < levels && book[s][tick + d] != 0) found = tick + d;
+            else if (d <= tick && book[s][tick - d] != 0) found = tick - d;
+        }
+        if (found == levels) continue;
+
+        const Quantity level = book[s][found];
+        const bool delete_level = chance(generator) <= config.chance_of_delete;
+        remove(side, found, delete_level ? level : std::max<Quantity>(level / 2, 1));
+    }
+
+    return events;
+}
+
+template <template <Side> class Store>
+double Replay(const std::vector<MarketEvent>& events, Price tick_size, std::uint64_t& checksum) {
+    Store<Side::kBid> bids(tick_size);
+    Store<Side::kAsk> asks(tick_size);
+
+    const auto start = Clock::now();
+    for (const MarketEvent& e : events) {
+        if (e.side == Side::kBid) {
+            if (e.event == LevelEvent::kAddLevel) bids.Add(e.price, e.quantity);
+            else bids.Reduce(e.price, e.quantity);
+            if (auto best = bids.Best()) checksum += best->price;
+        } else {
+            if (e.event == LevelEvent::kAddLevel) asks.Add(e.price, e.quantity);
+            else asks.Reduce(e.price, e.quantity);
+            if (auto best = asks.Best()) checksum += best->price;
+        }
+    }
+    const auto elapsed = Clock::now() - start;
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+           static_cast<double>(events.size());
+}
+
+template <template <Side> class Store>
+void Run(const char* name, const std::vector<MarketEvent>& events, Price tick_size, int passes) {
+    std::uint64_t checksum = 0;
+    double best = Replay<Store>(events, tick_size, checksum);
+    for (int i = 1; i < passes; ++i) best = std::min(best, Replay<Store>(events, tick_size, checksum));
+
+    std::cout << name << ": " << best << " ns/event (checksum " << checksum << ")" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    const ExchangeConfig config = ExchangeConfig::New();
+    const std::size_t count = static_cast<std::size_t>(std::max(get_env_int("BENCH_EVENTS", 5000000), 1));
+    const int passes = std::max(get_env_int("BENCH_PASSES", 5), 1);
+    const Price tick_size = std::max<Price>(config.min_tick_size, 1);
+
+    const std::vector<MarketEvent> events = GenerateFlow(config, count);
+    std::cout << "Replaying " << events.size() << " events over " << config.price_levels
+              << " price levels, best of " << passes << " passes" << std::endl;
+
+    Run<TreeLevels>("TreeLevels", events, tick_size, passes);
+    Run<FlatLevels>("FlatLevels", events, tick_size, passes);
+    Run<PriceLadder>("PriceLadder", events, tick_size, passes);
+}
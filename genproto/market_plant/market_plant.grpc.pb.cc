@@ -26,6 +26,7 @@ namespace v1 {
 static const char* MarketPlantService_method_names[] = {
   "/market_plant.v1.MarketPlantService/StreamUpdates",
   "/market_plant.v1.MarketPlantService/UpdateSubscriptions",
+  "/market_plant.v1.MarketPlantService/GetSnapshot",
 };
 
 std::unique_ptr< MarketPlantService::Stub> MarketPlantService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -37,6 +38,7 @@ std::unique_ptr< MarketPlantService::Stub> MarketPlantService::NewStub(const std
 MarketPlantService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_StreamUpdates_(MarketPlantService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   , rpcmethod_UpdateSubscriptions_(MarketPlantService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetSnapshot_(MarketPlantService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::ClientReader< ::market_plant::v1::StreamResponse>* MarketPlantService::Stub::StreamUpdatesRaw(::grpc::ClientContext* context, const ::market_plant::v1::Subscription& request) {
@@ -78,6 +80,29 @@ void MarketPlantService::Stub::async::UpdateSubscriptions(::grpc::ClientContext*
   return result;
 }
 
+::grpc::Status MarketPlantService::Stub::GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::market_plant::v1::SnapshotResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetSnapshot_, context, request, response);
+}
+
+void MarketPlantService::Stub::async::GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetSnapshot_, context, request, response, std::move(f));
+}
+
+void MarketPlantService::Stub::async::GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetSnapshot_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>* MarketPlantService::Stub::PrepareAsyncGetSnapshotRaw(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::market_plant::v1::SnapshotResponse, ::market_plant::v1::InstrumentIds, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetSnapshot_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>* MarketPlantService::Stub::AsyncGetSnapshotRaw(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetSnapshotRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 MarketPlantService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MarketPlantService_method_names[0],
@@ -99,6 +124,16 @@ MarketPlantService::Service::Service() {
              ::google::protobuf::Empty* resp) {
                return service->UpdateSubscriptions(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MarketPlantService_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MarketPlantService::Service, ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MarketPlantService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::market_plant::v1::InstrumentIds* req,
+             ::market_plant::v1::SnapshotResponse* resp) {
+               return service->GetSnapshot(ctx, req, resp);
+             }, this)));
 }
 
 MarketPlantService::Service::~Service() {
@@ -118,6 +153,13 @@ MarketPlantService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MarketPlantService::Service::GetSnapshot(::grpc::ServerContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace market_plant
 }  // namespace v1
@@ -55,6 +55,14 @@ class MarketPlantService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncUpdateSubscriptions(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncUpdateSubscriptionsRaw(context, request, cq));
     }
+    // Top-depth snapshots of a batch of instruments, read without blocking the feed
+    virtual ::grpc::Status GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::market_plant::v1::SnapshotResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::market_plant::v1::SnapshotResponse>> AsyncGetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::market_plant::v1::SnapshotResponse>>(AsyncGetSnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::market_plant::v1::SnapshotResponse>> PrepareAsyncGetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::market_plant::v1::SnapshotResponse>>(PrepareAsyncGetSnapshotRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -63,6 +71,9 @@ class MarketPlantService final {
       // Control-plane for modifying subscriptions
       virtual void UpdateSubscriptions(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void UpdateSubscriptions(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Top-depth snapshots of a batch of instruments, read without blocking the feed
+      virtual void GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -73,6 +84,8 @@ class MarketPlantService final {
     virtual ::grpc::ClientAsyncReaderInterface< ::market_plant::v1::StreamResponse>* PrepareAsyncStreamUpdatesRaw(::grpc::ClientContext* context, const ::market_plant::v1::Subscription& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncUpdateSubscriptionsRaw(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncUpdateSubscriptionsRaw(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::market_plant::v1::SnapshotResponse>* AsyncGetSnapshotRaw(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::market_plant::v1::SnapshotResponse>* PrepareAsyncGetSnapshotRaw(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -93,12 +106,21 @@ class MarketPlantService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncUpdateSubscriptions(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncUpdateSubscriptionsRaw(context, request, cq));
     }
+    ::grpc::Status GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::market_plant::v1::SnapshotResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>> AsyncGetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>>(AsyncGetSnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>> PrepareAsyncGetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>>(PrepareAsyncGetSnapshotRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
       void StreamUpdates(::grpc::ClientContext* context, const ::market_plant::v1::Subscription* request, ::grpc::ClientReadReactor< ::market_plant::v1::StreamResponse>* reactor) override;
       void UpdateSubscriptions(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void UpdateSubscriptions(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetSnapshot(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -115,8 +137,11 @@ class MarketPlantService final {
     ::grpc::ClientAsyncReader< ::market_plant::v1::StreamResponse>* PrepareAsyncStreamUpdatesRaw(::grpc::ClientContext* context, const ::market_plant::v1::Subscription& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncUpdateSubscriptionsRaw(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncUpdateSubscriptionsRaw(::grpc::ClientContext* context, const ::market_plant::v1::UpdateSubscriptionRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>* AsyncGetSnapshotRaw(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::market_plant::v1::SnapshotResponse>* PrepareAsyncGetSnapshotRaw(::grpc::ClientContext* context, const ::market_plant::v1::InstrumentIds& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_StreamUpdates_;
     const ::grpc::internal::RpcMethod rpcmethod_UpdateSubscriptions_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetSnapshot_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -128,6 +153,8 @@ class MarketPlantService final {
     virtual ::grpc::Status StreamUpdates(::grpc::ServerContext* context, const ::market_plant::v1::Subscription* request, ::grpc::ServerWriter< ::market_plant::v1::StreamResponse>* writer);
     // Control-plane for modifying subscriptions
     virtual ::grpc::Status UpdateSubscriptions(::grpc::ServerContext* context, const ::market_plant::v1::UpdateSubscriptionRequest* request, ::google::protobuf::Empty* response);
+    // Top-depth snapshots of a batch of instruments, read without blocking the feed
+    virtual ::grpc::Status GetSnapshot(::grpc::ServerContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_StreamUpdates : public BaseClass {
@@ -169,7 +196,27 @@ class MarketPlantService final {
       ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_StreamUpdates<WithAsyncMethod_UpdateSubscriptions<Service > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetSnapshot() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_GetSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSnapshot(::grpc::ServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetSnapshot(::grpc::ServerContext* context, ::market_plant::v1::InstrumentIds* request, ::grpc::ServerAsyncResponseWriter< ::market_plant::v1::SnapshotResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_StreamUpdates<WithAsyncMethod_UpdateSubscriptions<WithAsyncMethod_GetSnapshot<Service > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_StreamUpdates : public BaseClass {
    private:
@@ -219,7 +266,34 @@ class MarketPlantService final {
     virtual ::grpc::ServerUnaryReactor* UpdateSubscriptions(
       ::grpc::CallbackServerContext* /*context*/, const ::market_plant::v1::UpdateSubscriptionRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_StreamUpdates<WithCallbackMethod_UpdateSubscriptions<Service > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetSnapshot() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::market_plant::v1::InstrumentIds* request, ::market_plant::v1::SnapshotResponse* response) { return this->GetSnapshot(context, request, response); }));}
+    void SetMessageAllocatorFor_GetSnapshot(
+        ::grpc::MessageAllocator< ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSnapshot(::grpc::ServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetSnapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_StreamUpdates<WithCallbackMethod_UpdateSubscriptions<WithCallbackMethod_GetSnapshot<Service > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_StreamUpdates : public BaseClass {
@@ -256,6 +330,23 @@ class MarketPlantService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetSnapshot() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_GetSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSnapshot(::grpc::ServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_StreamUpdates : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -296,6 +387,26 @@ class MarketPlantService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetSnapshot() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_GetSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSnapshot(::grpc::ServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetSnapshot(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_StreamUpdates : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -340,6 +451,28 @@ class MarketPlantService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetSnapshot() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetSnapshot(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSnapshot(::grpc::ServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetSnapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_UpdateSubscriptions : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -366,7 +499,34 @@ class MarketPlantService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedUpdateSubscriptions(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::market_plant::v1::UpdateSubscriptionRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_UpdateSubscriptions<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetSnapshot() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::market_plant::v1::InstrumentIds, ::market_plant::v1::SnapshotResponse>* streamer) {
+                       return this->StreamedGetSnapshot(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetSnapshot(::grpc::ServerContext* /*context*/, const ::market_plant::v1::InstrumentIds* /*request*/, ::market_plant::v1::SnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetSnapshot(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::market_plant::v1::InstrumentIds,::market_plant::v1::SnapshotResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_UpdateSubscriptions<WithStreamedUnaryMethod_GetSnapshot<Service > > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_StreamUpdates : public BaseClass {
    private:
@@ -395,7 +555,7 @@ class MarketPlantService final {
     virtual ::grpc::Status StreamedStreamUpdates(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::market_plant::v1::Subscription,::market_plant::v1::StreamResponse>* server_split_streamer) = 0;
   };
   typedef WithSplitStreamingMethod_StreamUpdates<Service > SplitStreamedService;
-  typedef WithSplitStreamingMethod_StreamUpdates<WithStreamedUnaryMethod_UpdateSubscriptions<Service > > StreamedService;
+  typedef WithSplitStreamingMethod_StreamUpdates<WithStreamedUnaryMethod_UpdateSubscriptions<WithStreamedUnaryMethod_GetSnapshot<Service > > > StreamedService;
 };
 
 }  // namespace v1
@@ -27,6 +27,33 @@ namespace _fl = ::google::protobuf::internal::field_layout;
 namespace market_plant {
 namespace v1 {
 
+inline constexpr SubscriptionOptions::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        absolute_quantity_{false},
+        batch_updates_{false},
+        conflate_backlog_{0u} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR SubscriptionOptions::SubscriptionOptions(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(SubscriptionOptions_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct SubscriptionOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscriptionOptionsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscriptionOptionsDefaultTypeInternal() {}
+  union {
+    SubscriptionOptions _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscriptionOptionsDefaultTypeInternal _SubscriptionOptions_default_instance_;
+
 inline constexpr SubscriberInitialization::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -110,8 +137,9 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
 
 inline constexpr Subscription::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
-      : action_{},
-        _cached_size_{0},
+      : _cached_size_{0},
+        options_{nullptr},
+        action_{},
         _oneof_case_{} {}
 
 template <typename>
@@ -240,6 +268,32 @@ struct IncrementalUpdateDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncrementalUpdateDefaultTypeInternal _IncrementalUpdate_default_instance_;
 
+inline constexpr IncrementalBatch::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        updates_{},
+        conflated_{0u} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR IncrementalBatch::IncrementalBatch(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(IncrementalBatch_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct IncrementalBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncrementalBatchDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncrementalBatchDefaultTypeInternal() {}
+  union {
+    IncrementalBatch _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncrementalBatchDefaultTypeInternal _IncrementalBatch_default_instance_;
+
 inline constexpr OrderBookUpdate::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -267,6 +321,83 @@ struct OrderBookUpdateDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderBookUpdateDefaultTypeInternal _OrderBookUpdate_default_instance_;
 
+inline constexpr InstrumentSnapshot::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        snapshot_{nullptr},
+        version_{::uint64_t{0u}},
+        instrument_id_{0u} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR InstrumentSnapshot::InstrumentSnapshot(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(InstrumentSnapshot_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct InstrumentSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstrumentSnapshotDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstrumentSnapshotDefaultTypeInternal() {}
+  union {
+    InstrumentSnapshot _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstrumentSnapshotDefaultTypeInternal _InstrumentSnapshot_default_instance_;
+
+inline constexpr UpdateBatch::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        updates_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR UpdateBatch::UpdateBatch(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(UpdateBatch_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct UpdateBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateBatchDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateBatchDefaultTypeInternal() {}
+  union {
+    UpdateBatch _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateBatchDefaultTypeInternal _UpdateBatch_default_instance_;
+
+inline constexpr SnapshotResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        snapshots_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR SnapshotResponse::SnapshotResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(SnapshotResponse_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct SnapshotResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotResponseDefaultTypeInternal() {}
+  union {
+    SnapshotResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotResponseDefaultTypeInternal _SnapshotResponse_default_instance_;
+
 inline constexpr StreamResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : payload_{},
@@ -329,27 +460,65 @@ const ::uint32_t
         4, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::IncrementalUpdate, _impl_.update_),
         0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::IncrementalBatch, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::IncrementalBatch, _impl_.updates_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::IncrementalBatch, _impl_.conflated_),
+        0,
+        1,
         0x085, // bitmap
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_._has_bits_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_._oneof_case_[0]),
-        8, // hasbit index offset
+        9, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_.instrument_id_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_.update_type_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_.update_type_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_.update_type_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_.update_type_),
         0,
         ~0u,
         ~0u,
+        ~0u,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::InstrumentSnapshot, _impl_._has_bits_),
+        6, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::InstrumentSnapshot, _impl_.instrument_id_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::InstrumentSnapshot, _impl_.version_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::InstrumentSnapshot, _impl_.snapshot_),
+        2,
+        1,
+        0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::SnapshotResponse, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::SnapshotResponse, _impl_.snapshots_),
+        0,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::InstrumentIds, _impl_._has_bits_),
         4, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::InstrumentIds, _impl_.ids_),
         0,
-        0x004, // bitmap
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::SubscriptionOptions, _impl_._has_bits_),
+        6, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::SubscriptionOptions, _impl_.absolute_quantity_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::SubscriptionOptions, _impl_.batch_updates_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::SubscriptionOptions, _impl_.conflate_backlog_),
+        0,
+        1,
+        2,
+        0x085, // bitmap
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_._has_bits_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_._oneof_case_[0]),
+        8, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_.action_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_.action_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_.options_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_.action_),
+        ~0u,
+        ~0u,
+        0,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::SubscriberInitialization, _impl_._has_bits_),
         5, // hasbit index offset
@@ -357,11 +526,17 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::SubscriberInitialization, _impl_.session_id_),
         1,
         0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::UpdateBatch, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::UpdateBatch, _impl_.updates_),
+        0,
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::StreamResponse, _impl_._oneof_case_[0]),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::StreamResponse, _impl_.payload_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::StreamResponse, _impl_.payload_),
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::StreamResponse, _impl_.payload_),
+        PROTOBUF_FIELD_OFFSET(::market_plant::v1::StreamResponse, _impl_.payload_),
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::market_plant::v1::UpdateSubscriptionRequest, _impl_._has_bits_),
         6, // hasbit index offset
@@ -379,22 +554,32 @@ static const ::_pbi::MigrationSchema
         {9, sizeof(::market_plant::v1::OrderBookEventUpdate)},
         {16, sizeof(::market_plant::v1::SnapshotUpdate)},
         {23, sizeof(::market_plant::v1::IncrementalUpdate)},
-        {28, sizeof(::market_plant::v1::OrderBookUpdate)},
-        {39, sizeof(::market_plant::v1::InstrumentIds)},
-        {44, sizeof(::market_plant::v1::Subscription)},
-        {49, sizeof(::market_plant::v1::SubscriberInitialization)},
-        {56, sizeof(::market_plant::v1::StreamResponse)},
-        {61, sizeof(::market_plant::v1::UpdateSubscriptionRequest)},
+        {28, sizeof(::market_plant::v1::IncrementalBatch)},
+        {35, sizeof(::market_plant::v1::OrderBookUpdate)},
+        {48, sizeof(::market_plant::v1::InstrumentSnapshot)},
+        {57, sizeof(::market_plant::v1::SnapshotResponse)},
+        {62, sizeof(::market_plant::v1::InstrumentIds)},
+        {67, sizeof(::market_plant::v1::SubscriptionOptions)},
+        {76, sizeof(::market_plant::v1::Subscription)},
+        {87, sizeof(::market_plant::v1::SubscriberInitialization)},
+        {94, sizeof(::market_plant::v1::UpdateBatch)},
+        {99, sizeof(::market_plant::v1::StreamResponse)},
+        {105, sizeof(::market_plant::v1::UpdateSubscriptionRequest)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::market_plant::v1::_Level_default_instance_._instance,
     &::market_plant::v1::_OrderBookEventUpdate_default_instance_._instance,
     &::market_plant::v1::_SnapshotUpdate_default_instance_._instance,
     &::market_plant::v1::_IncrementalUpdate_default_instance_._instance,
+    &::market_plant::v1::_IncrementalBatch_default_instance_._instance,
     &::market_plant::v1::_OrderBookUpdate_default_instance_._instance,
+    &::market_plant::v1::_InstrumentSnapshot_default_instance_._instance,
+    &::market_plant::v1::_SnapshotResponse_default_instance_._instance,
     &::market_plant::v1::_InstrumentIds_default_instance_._instance,
+    &::market_plant::v1::_SubscriptionOptions_default_instance_._instance,
     &::market_plant::v1::_Subscription_default_instance_._instance,
     &::market_plant::v1::_SubscriberInitialization_default_instance_._instance,
+    &::market_plant::v1::_UpdateBatch_default_instance_._instance,
     &::market_plant::v1::_StreamResponse_default_instance_._instance,
     &::market_plant::v1::_UpdateSubscriptionRequest_default_instance_._instance,
 };
@@ -411,32 +596,50 @@ const char descriptor_table_protodef_market_5fplant_2fmarket_5fplant_2eproto[] A
     "v1.OrderBookEventUpdate\0223\n\004asks\030\002 \003(\0132%."
     "market_plant.v1.OrderBookEventUpdate\"J\n\021"
     "IncrementalUpdate\0225\n\006update\030\001 \001(\0132%.mark"
-    "et_plant.v1.OrderBookEventUpdate\"\247\001\n\017Ord"
-    "erBookUpdate\022\025\n\rinstrument_id\030\001 \001(\r\0223\n\010s"
-    "napshot\030\002 \001(\0132\037.market_plant.v1.Snapshot"
-    "UpdateH\000\0229\n\013incremental\030\003 \001(\0132\".market_p"
-    "lant.v1.IncrementalUpdateH\000B\r\n\013update_ty"
-    "pe\"\034\n\rInstrumentIds\022\013\n\003ids\030\001 \003(\r\"\204\001\n\014Sub"
-    "scription\0223\n\tsubscribe\030\001 \001(\0132\036.market_pl"
-    "ant.v1.InstrumentIdsH\000\0225\n\013unsubscribe\030\002 "
-    "\001(\0132\036.market_plant.v1.InstrumentIdsH\000B\010\n"
-    "\006action\"E\n\030SubscriberInitialization\022\025\n\rs"
-    "ubscriber_id\030\001 \001(\r\022\022\n\nsession_id\030\002 \001(\014\"\212"
-    "\001\n\016StreamResponse\0229\n\004init\030\001 \001(\0132).market"
-    "_plant.v1.SubscriberInitializationH\000\0222\n\006"
-    "update\030\002 \001(\0132 .market_plant.v1.OrderBook"
-    "UpdateH\000B\t\n\007payload\"u\n\031UpdateSubscriptio"
-    "nRequest\022\025\n\rsubscriber_id\030\001 \001(\r\022\022\n\nsessi"
-    "on_id\030\002 \001(\014\022-\n\006change\030\003 \001(\0132\035.market_pla"
-    "nt.v1.Subscription*.\n\004Side\022\024\n\020SIDE_UNSPE"
-    "CIFIED\020\000\022\007\n\003BID\020\001\022\007\n\003ASK\020\002*L\n\022OrderBookE"
-    "ventType\022\025\n\021EVENT_UNSPECIFIED\020\000\022\r\n\tADD_L"
-    "EVEL\020\001\022\020\n\014REDUCE_LEVEL\020\0022\302\001\n\022MarketPlant"
-    "Service\022Q\n\rStreamUpdates\022\035.market_plant."
-    "v1.Subscription\032\037.market_plant.v1.Stream"
-    "Response0\001\022Y\n\023UpdateSubscriptions\022*.mark"
-    "et_plant.v1.UpdateSubscriptionRequest\032\026."
-    "google.protobuf.Emptyb\006proto3"
+    "et_plant.v1.OrderBookEventUpdate\"]\n\020Incr"
+    "ementalBatch\0226\n\007updates\030\001 \003(\0132%.market_p"
+    "lant.v1.OrderBookEventUpdate\022\021\n\tconflate"
+    "d\030\002 \001(\r\"\333\001\n\017OrderBookUpdate\022\025\n\rinstrumen"
+    "t_id\030\001 \001(\r\0223\n\010snapshot\030\002 \001(\0132\037.market_pl"
+    "ant.v1.SnapshotUpdateH\000\0229\n\013incremental\030\003"
+    " \001(\0132\".market_plant.v1.IncrementalUpdate"
+    "H\000\0222\n\005batch\030\004 \001(\0132!.market_plant.v1.Incr"
+    "ementalBatchH\000B\r\n\013update_type\"o\n\022Instrum"
+    "entSnapshot\022\025\n\rinstrument_id\030\001 \001(\r\022\017\n\007ve"
+    "rsion\030\002 \001(\004\0221\n\010snapshot\030\003 \001(\0132\037.market_p"
+    "lant.v1.SnapshotUpdate\"J\n\020SnapshotRespon"
+    "se\0226\n\tsnapshots\030\001 \003(\0132#.market_plant.v1."
+    "InstrumentSnapshot\"\034\n\rInstrumentIds\022\013\n\003i"
+    "ds\030\001 \003(\r\"a\n\023SubscriptionOptions\022\031\n\021absol"
+    "ute_quantity\030\001 \001(\010\022\025\n\rbatch_updates\030\002 \001("
+    "\010\022\030\n\020conflate_backlog\030\003 \001(\r\"\273\001\n\014Subscrip"
+    "tion\0223\n\tsubscribe\030\001 \001(\0132\036.market_plant.v"
+    "1.InstrumentIdsH\000\0225\n\013unsubscribe\030\002 \001(\0132\036"
+    ".market_plant.v1.InstrumentIdsH\000\0225\n\007opti"
+    "ons\030\003 \001(\0132$.market_plant.v1.Subscription"
+    "OptionsB\010\n\006action\"E\n\030SubscriberInitializ"
+    "ation\022\025\n\rsubscriber_id\030\001 \001(\r\022\022\n\nsession_"
+    "id\030\002 \001(\014\"@\n\013UpdateBatch\0221\n\007updates\030\002 \003(\013"
+    "2 .market_plant.v1.OrderBookUpdate\"\271\001\n\016S"
+    "treamResponse\0229\n\004init\030\001 \001(\0132).market_pla"
+    "nt.v1.SubscriberInitializationH\000\0222\n\006upda"
+    "te\030\002 \001(\0132 .market_plant.v1.OrderBookUpda"
+    "teH\000\022-\n\005batch\030\003 \001(\0132\034.market_plant.v1.Up"
+    "dateBatchH\000B\t\n\007payload\"u\n\031UpdateSubscrip"
+    "tionRequest\022\025\n\rsubscriber_id\030\001 \001(\r\022\022\n\nse"
+    "ssion_id\030\002 \001(\014\022-\n\006change\030\003 \001(\0132\035.market_"
+    "plant.v1.Subscription*.\n\004Side\022\024\n\020SIDE_UN"
+    "SPECIFIED\020\000\022\007\n\003BID\020\001\022\007\n\003ASK\020\002*[\n\022OrderBo"
+    "okEventType\022\025\n\021EVENT_UNSPECIFIED\020\000\022\r\n\tAD"
+    "D_LEVEL\020\001\022\020\n\014REDUCE_LEVEL\020\002\022\r\n\tSET_LEVEL"
+    "\020\0032\224\002\n\022MarketPlantService\022Q\n\rStreamUpdat"
+    "es\022\035.market_plant.v1.Subscription\032\037.mark"
+    "et_plant.v1.StreamResponse0\001\022Y\n\023UpdateSu"
+    "bscriptions\022*.market_plant.v1.UpdateSubs"
+    "criptionRequest\032\026.google.protobuf.Empty\022"
+    "P\n\013GetSnapshot\022\036.market_plant.v1.Instrum"
+    "entIds\032!.market_plant.v1.SnapshotRespons"
+    "eb\006proto3"
 };
 static const ::_pbi::DescriptorTable* PROTOBUF_NONNULL const
     descriptor_table_market_5fplant_2fmarket_5fplant_2eproto_deps[1] = {
@@ -446,13 +649,13 @@ static ::absl::once_flag descriptor_table_market_5fplant_2fmarket_5fplant_2eprot
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_market_5fplant_2fmarket_5fplant_2eproto = {
     false,
     false,
-    1469,
+    2169,
     descriptor_table_protodef_market_5fplant_2fmarket_5fplant_2eproto,
     "market_plant/market_plant.proto",
     &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto_once,
     descriptor_table_market_5fplant_2fmarket_5fplant_2eproto_deps,
     1,
-    10,
+    15,
     schemas,
     file_default_instances,
     TableStruct_market_5fplant_2fmarket_5fplant_2eproto::offsets,
@@ -472,7 +675,7 @@ const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL OrderBookEventType_de
   return file_level_enum_descriptors_market_5fplant_2fmarket_5fplant_2eproto[1];
 }
 PROTOBUF_CONSTINIT const uint32_t OrderBookEventType_internal_data_[] = {
-    196608u, 0u, };
+    262144u, 0u, };
 // ===================================================================
 
 class Level::_Internal {
@@ -1710,412 +1913,1411 @@ void IncrementalUpdate::InternalSwap(IncrementalUpdate* PROTOBUF_RESTRICT PROTOB
 }
 // ===================================================================
 
-class OrderBookUpdate::_Internal {
+class IncrementalBatch::_Internal {
  public:
   using HasBits =
-      decltype(::std::declval<OrderBookUpdate>()._impl_._has_bits_);
+      decltype(::std::declval<IncrementalBatch>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_._has_bits_);
-  static constexpr ::int32_t kOneofCaseOffset =
-      PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_._oneof_case_);
+      8 * PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_._has_bits_);
 };
 
-void OrderBookUpdate::set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE snapshot) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  clear_update_type();
-  if (snapshot) {
-    ::google::protobuf::Arena* submessage_arena = snapshot->GetArena();
-    if (message_arena != submessage_arena) {
-      snapshot = ::google::protobuf::internal::GetOwnedMessage(message_arena, snapshot, submessage_arena);
-    }
-    set_has_snapshot();
-    _impl_.update_type_.snapshot_ = snapshot;
-  }
-  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.OrderBookUpdate.snapshot)
-}
-void OrderBookUpdate::set_allocated_incremental(::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE incremental) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  clear_update_type();
-  if (incremental) {
-    ::google::protobuf::Arena* submessage_arena = incremental->GetArena();
-    if (message_arena != submessage_arena) {
-      incremental = ::google::protobuf::internal::GetOwnedMessage(message_arena, incremental, submessage_arena);
-    }
-    set_has_incremental();
-    _impl_.update_type_.incremental_ = incremental;
-  }
-  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.OrderBookUpdate.incremental)
-}
-OrderBookUpdate::OrderBookUpdate(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+IncrementalBatch::IncrementalBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, OrderBookUpdate_class_data_.base()) {
+    : ::google::protobuf::Message(arena, IncrementalBatch_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(arena_constructor:market_plant.v1.IncrementalBatch)
 }
-PROTOBUF_NDEBUG_INLINE OrderBookUpdate::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE IncrementalBatch::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::market_plant::v1::OrderBookUpdate& from_msg)
+    [[maybe_unused]] const ::market_plant::v1::IncrementalBatch& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        update_type_{},
-        _oneof_case_{from._oneof_case_[0]} {}
+        updates_{visibility, arena, from.updates_} {}
 
-OrderBookUpdate::OrderBookUpdate(
+IncrementalBatch::IncrementalBatch(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const OrderBookUpdate& from)
+    const IncrementalBatch& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, OrderBookUpdate_class_data_.base()) {
+    : ::google::protobuf::Message(arena, IncrementalBatch_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  OrderBookUpdate* const _this = this;
+  IncrementalBatch* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.instrument_id_ = from._impl_.instrument_id_;
-  switch (update_type_case()) {
-    case UPDATE_TYPE_NOT_SET:
-      break;
-      case kSnapshot:
-        _impl_.update_type_.snapshot_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.snapshot_);
-        break;
-      case kIncremental:
-        _impl_.update_type_.incremental_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.incremental_);
-        break;
-  }
+  _impl_.conflated_ = from._impl_.conflated_;
 
-  // @@protoc_insertion_point(copy_constructor:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(copy_constructor:market_plant.v1.IncrementalBatch)
 }
-PROTOBUF_NDEBUG_INLINE OrderBookUpdate::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE IncrementalBatch::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        update_type_{},
-        _oneof_case_{} {}
+        updates_{visibility, arena} {}
 
-inline void OrderBookUpdate::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void IncrementalBatch::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.instrument_id_ = {};
+  _impl_.conflated_ = {};
 }
-OrderBookUpdate::~OrderBookUpdate() {
-  // @@protoc_insertion_point(destructor:market_plant.v1.OrderBookUpdate)
+IncrementalBatch::~IncrementalBatch() {
+  // @@protoc_insertion_point(destructor:market_plant.v1.IncrementalBatch)
   SharedDtor(*this);
 }
-inline void OrderBookUpdate::SharedDtor(MessageLite& self) {
-  OrderBookUpdate& this_ = static_cast<OrderBookUpdate&>(self);
+inline void IncrementalBatch::SharedDtor(MessageLite& self) {
+  IncrementalBatch& this_ = static_cast<IncrementalBatch&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
-  if (this_.has_update_type()) {
-    this_.clear_update_type();
-  }
   this_._impl_.~Impl_();
 }
 
-void OrderBookUpdate::clear_update_type() {
-// @@protoc_insertion_point(one_of_clear_start:market_plant.v1.OrderBookUpdate)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  switch (update_type_case()) {
-    case kSnapshot: {
-      if (GetArena() == nullptr) {
-        delete _impl_.update_type_.snapshot_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.snapshot_);
-      }
-      break;
-    }
-    case kIncremental: {
-      if (GetArena() == nullptr) {
-        delete _impl_.update_type_.incremental_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.incremental_);
-      }
-      break;
-    }
-    case UPDATE_TYPE_NOT_SET: {
-      break;
-    }
-  }
-  _impl_._oneof_case_[0] = UPDATE_TYPE_NOT_SET;
-}
-
-
-inline void* PROTOBUF_NONNULL OrderBookUpdate::PlacementNew_(
+inline void* PROTOBUF_NONNULL IncrementalBatch::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) OrderBookUpdate(arena);
+  return ::new (mem) IncrementalBatch(arena);
 }
-constexpr auto OrderBookUpdate::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(OrderBookUpdate),
-                                            alignof(OrderBookUpdate));
+constexpr auto IncrementalBatch::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_.updates_) +
+          decltype(IncrementalBatch::_impl_.updates_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(IncrementalBatch), alignof(IncrementalBatch), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&IncrementalBatch::PlacementNew_,
+                                 sizeof(IncrementalBatch),
+                                 alignof(IncrementalBatch));
+  }
 }
-constexpr auto OrderBookUpdate::InternalGenerateClassData_() {
+constexpr auto IncrementalBatch::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_OrderBookUpdate_default_instance_._instance,
+          &_IncrementalBatch_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &OrderBookUpdate::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<OrderBookUpdate>(),
+          &IncrementalBatch::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<IncrementalBatch>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &OrderBookUpdate::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<OrderBookUpdate>(), &OrderBookUpdate::ByteSizeLong,
-              &OrderBookUpdate::_InternalSerialize,
+          &IncrementalBatch::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<IncrementalBatch>(), &IncrementalBatch::ByteSizeLong,
+              &IncrementalBatch::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_._cached_size_),
           false,
       },
-      &OrderBookUpdate::kDescriptorMethods,
+      &IncrementalBatch::kDescriptorMethods,
       &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull OrderBookUpdate_class_data_ =
-        OrderBookUpdate::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull IncrementalBatch_class_data_ =
+        IncrementalBatch::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-OrderBookUpdate::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&OrderBookUpdate_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(OrderBookUpdate_class_data_.tc_table);
-  return OrderBookUpdate_class_data_.base();
+IncrementalBatch::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&IncrementalBatch_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(IncrementalBatch_class_data_.tc_table);
+  return IncrementalBatch_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 3, 2, 0, 2>
-OrderBookUpdate::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 1, 0, 2>
+IncrementalBatch::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_._has_bits_),
     0, // no _extensions_
-    3, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    2,  // num_aux_entries
+    2,  // num_field_entries
+    1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    OrderBookUpdate_class_data_.base(),
+    IncrementalBatch_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::market_plant::v1::OrderBookUpdate>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::market_plant::v1::IncrementalBatch>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // uint32 instrument_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OrderBookUpdate, _impl_.instrument_id_), 0>(),
-     {8, 0, 0,
-      PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.instrument_id_)}},
+    // uint32 conflated = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(IncrementalBatch, _impl_.conflated_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_.conflated_)}},
+    // repeated .market_plant.v1.OrderBookEventUpdate updates = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_.updates_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // uint32 instrument_id = 1;
-    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.instrument_id_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
-    // .market_plant.v1.SnapshotUpdate snapshot = 2;
-    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.update_type_.snapshot_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .market_plant.v1.IncrementalUpdate incremental = 3;
-    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.update_type_.incremental_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .market_plant.v1.OrderBookEventUpdate updates = 1;
+    {PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_.updates_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // uint32 conflated = 2;
+    {PROTOBUF_FIELD_OFFSET(IncrementalBatch, _impl_.conflated_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
   }},
   {{
-      {::_pbi::TcParser::GetTable<::market_plant::v1::SnapshotUpdate>()},
-      {::_pbi::TcParser::GetTable<::market_plant::v1::IncrementalUpdate>()},
+      {::_pbi::TcParser::GetTable<::market_plant::v1::OrderBookEventUpdate>()},
   }},
   {{
   }},
 };
-PROTOBUF_NOINLINE void OrderBookUpdate::Clear() {
-// @@protoc_insertion_point(message_clear_start:market_plant.v1.OrderBookUpdate)
+PROTOBUF_NOINLINE void IncrementalBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:market_plant.v1.IncrementalBatch)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.instrument_id_ = 0u;
-  clear_update_type();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.updates_.Clear();
+  }
+  _impl_.conflated_ = 0u;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL OrderBookUpdate::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL IncrementalBatch::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const OrderBookUpdate& this_ = static_cast<const OrderBookUpdate&>(base);
+  const IncrementalBatch& this_ = static_cast<const IncrementalBatch&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL OrderBookUpdate::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL IncrementalBatch::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const OrderBookUpdate& this_ = *this;
+  const IncrementalBatch& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.IncrementalBatch)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = this_._impl_._has_bits_[0];
-  // uint32 instrument_id = 1;
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (this_._internal_instrument_id() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-          1, this_._internal_instrument_id(), target);
+  // repeated .market_plant.v1.OrderBookEventUpdate updates = 1;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_updates_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_updates().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              1, repfield, repfield.GetCachedSize(),
+              target, stream);
     }
   }
 
-  switch (this_.update_type_case()) {
-    case kSnapshot: {
-      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          2, *this_._impl_.update_type_.snapshot_, this_._impl_.update_type_.snapshot_->GetCachedSize(), target,
-          stream);
-      break;
-    }
-    case kIncremental: {
-      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          3, *this_._impl_.update_type_.incremental_, this_._impl_.update_type_.incremental_->GetCachedSize(), target,
-          stream);
-      break;
+  // uint32 conflated = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_conflated() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          2, this_._internal_conflated(), target);
     }
-    default:
-      break;
   }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.IncrementalBatch)
   return target;
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t OrderBookUpdate::ByteSizeLong(const MessageLite& base) {
-  const OrderBookUpdate& this_ = static_cast<const OrderBookUpdate&>(base);
+::size_t IncrementalBatch::ByteSizeLong(const MessageLite& base) {
+  const IncrementalBatch& this_ = static_cast<const IncrementalBatch&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t OrderBookUpdate::ByteSizeLong() const {
-  const OrderBookUpdate& this_ = *this;
+::size_t IncrementalBatch::ByteSizeLong() const {
+  const IncrementalBatch& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.IncrementalBatch)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
-   {
-    // uint32 instrument_id = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-      if (this_._internal_instrument_id() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-            this_._internal_instrument_id());
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // repeated .market_plant.v1.OrderBookEventUpdate updates = 1;
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_updates_size();
+      for (const auto& msg : this_._internal_updates()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
       }
     }
-  }
-  switch (this_.update_type_case()) {
-    // .market_plant.v1.SnapshotUpdate snapshot = 2;
-    case kSnapshot: {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.snapshot_);
-      break;
-    }
-    // .market_plant.v1.IncrementalUpdate incremental = 3;
-    case kIncremental: {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.incremental_);
-      break;
-    }
-    case UPDATE_TYPE_NOT_SET: {
-      break;
+    // uint32 conflated = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_conflated() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_conflated());
+      }
     }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
 }
 
-void OrderBookUpdate::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void IncrementalBatch::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<OrderBookUpdate*>(&to_msg);
-  auto& from = static_cast<const OrderBookUpdate&>(from_msg);
+      static_cast<IncrementalBatch*>(&to_msg);
+  auto& from = static_cast<const IncrementalBatch&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
   ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.IncrementalBatch)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (from._internal_instrument_id() != 0) {
-      _this->_impl_.instrument_id_ = from._impl_.instrument_id_;
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _this->_internal_mutable_updates()->InternalMergeFromWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), arena,
+          from._internal_updates());
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_conflated() != 0) {
+        _this->_impl_.conflated_ = from._impl_.conflated_;
+      }
     }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
-  if (const uint32_t oneof_from_case =
-          from._impl_._oneof_case_[0]) {
-    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
-    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
-    if (oneof_needs_init) {
-      if (oneof_to_case != 0) {
-        _this->clear_update_type();
-      }
-      _this->_impl_._oneof_case_[0] = oneof_from_case;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void IncrementalBatch::CopyFrom(const IncrementalBatch& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.IncrementalBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void IncrementalBatch::InternalSwap(IncrementalBatch* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+  swap(_impl_.conflated_, other->_impl_.conflated_);
+}
+
+::google::protobuf::Metadata IncrementalBatch::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class OrderBookUpdate::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<OrderBookUpdate>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+      PROTOBUF_FIELD_OFFSET(::market_plant::v1::OrderBookUpdate, _impl_._oneof_case_);
+};
+
+void OrderBookUpdate::set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE snapshot) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_update_type();
+  if (snapshot) {
+    ::google::protobuf::Arena* submessage_arena = snapshot->GetArena();
+    if (message_arena != submessage_arena) {
+      snapshot = ::google::protobuf::internal::GetOwnedMessage(message_arena, snapshot, submessage_arena);
+    }
+    set_has_snapshot();
+    _impl_.update_type_.snapshot_ = snapshot;
+  }
+  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.OrderBookUpdate.snapshot)
+}
+void OrderBookUpdate::set_allocated_incremental(::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE incremental) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_update_type();
+  if (incremental) {
+    ::google::protobuf::Arena* submessage_arena = incremental->GetArena();
+    if (message_arena != submessage_arena) {
+      incremental = ::google::protobuf::internal::GetOwnedMessage(message_arena, incremental, submessage_arena);
+    }
+    set_has_incremental();
+    _impl_.update_type_.incremental_ = incremental;
+  }
+  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.OrderBookUpdate.incremental)
+}
+void OrderBookUpdate::set_allocated_batch(::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE batch) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_update_type();
+  if (batch) {
+    ::google::protobuf::Arena* submessage_arena = batch->GetArena();
+    if (message_arena != submessage_arena) {
+      batch = ::google::protobuf::internal::GetOwnedMessage(message_arena, batch, submessage_arena);
     }
+    set_has_batch();
+    _impl_.update_type_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.OrderBookUpdate.batch)
+}
+OrderBookUpdate::OrderBookUpdate(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, OrderBookUpdate_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:market_plant.v1.OrderBookUpdate)
+}
+PROTOBUF_NDEBUG_INLINE OrderBookUpdate::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::market_plant::v1::OrderBookUpdate& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        update_type_{},
+        _oneof_case_{from._oneof_case_[0]} {}
 
-    switch (oneof_from_case) {
-      case kSnapshot: {
-        if (oneof_needs_init) {
-          _this->_impl_.update_type_.snapshot_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.snapshot_);
-        } else {
-          _this->_impl_.update_type_.snapshot_->MergeFrom(*from._impl_.update_type_.snapshot_);
-        }
+OrderBookUpdate::OrderBookUpdate(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const OrderBookUpdate& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, OrderBookUpdate_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  OrderBookUpdate* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.instrument_id_ = from._impl_.instrument_id_;
+  switch (update_type_case()) {
+    case UPDATE_TYPE_NOT_SET:
+      break;
+      case kSnapshot:
+        _impl_.update_type_.snapshot_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.snapshot_);
         break;
-      }
-      case kIncremental: {
-        if (oneof_needs_init) {
-          _this->_impl_.update_type_.incremental_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.incremental_);
-        } else {
-          _this->_impl_.update_type_.incremental_->MergeFrom(*from._impl_.update_type_.incremental_);
-        }
+      case kIncremental:
+        _impl_.update_type_.incremental_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.incremental_);
         break;
+      case kBatch:
+        _impl_.update_type_.batch_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.batch_);
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:market_plant.v1.OrderBookUpdate)
+}
+PROTOBUF_NDEBUG_INLINE OrderBookUpdate::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        update_type_{},
+        _oneof_case_{} {}
+
+inline void OrderBookUpdate::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.instrument_id_ = {};
+}
+OrderBookUpdate::~OrderBookUpdate() {
+  // @@protoc_insertion_point(destructor:market_plant.v1.OrderBookUpdate)
+  SharedDtor(*this);
+}
+inline void OrderBookUpdate::SharedDtor(MessageLite& self) {
+  OrderBookUpdate& this_ = static_cast<OrderBookUpdate&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  if (this_.has_update_type()) {
+    this_.clear_update_type();
+  }
+  this_._impl_.~Impl_();
+}
+
+void OrderBookUpdate::clear_update_type() {
+// @@protoc_insertion_point(one_of_clear_start:market_plant.v1.OrderBookUpdate)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  switch (update_type_case()) {
+    case kSnapshot: {
+      if (GetArena() == nullptr) {
+        delete _impl_.update_type_.snapshot_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.snapshot_);
+      }
+      break;
+    }
+    case kIncremental: {
+      if (GetArena() == nullptr) {
+        delete _impl_.update_type_.incremental_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.incremental_);
+      }
+      break;
+    }
+    case kBatch: {
+      if (GetArena() == nullptr) {
+        delete _impl_.update_type_.batch_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.batch_);
+      }
+      break;
+    }
+    case UPDATE_TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = UPDATE_TYPE_NOT_SET;
+}
+
+
+inline void* PROTOBUF_NONNULL OrderBookUpdate::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) OrderBookUpdate(arena);
+}
+constexpr auto OrderBookUpdate::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(OrderBookUpdate),
+                                            alignof(OrderBookUpdate));
+}
+constexpr auto OrderBookUpdate::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_OrderBookUpdate_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &OrderBookUpdate::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<OrderBookUpdate>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &OrderBookUpdate::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<OrderBookUpdate>(), &OrderBookUpdate::ByteSizeLong,
+              &OrderBookUpdate::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_._cached_size_),
+          false,
+      },
+      &OrderBookUpdate::kDescriptorMethods,
+      &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull OrderBookUpdate_class_data_ =
+        OrderBookUpdate::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+OrderBookUpdate::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&OrderBookUpdate_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(OrderBookUpdate_class_data_.tc_table);
+  return OrderBookUpdate_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 4, 3, 0, 2>
+OrderBookUpdate::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    3,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    OrderBookUpdate_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::market_plant::v1::OrderBookUpdate>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // uint32 instrument_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OrderBookUpdate, _impl_.instrument_id_), 0>(),
+     {8, 0, 0,
+      PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.instrument_id_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // uint32 instrument_id = 1;
+    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.instrument_id_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // .market_plant.v1.SnapshotUpdate snapshot = 2;
+    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.update_type_.snapshot_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .market_plant.v1.IncrementalUpdate incremental = 3;
+    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.update_type_.incremental_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .market_plant.v1.IncrementalBatch batch = 4;
+    {PROTOBUF_FIELD_OFFSET(OrderBookUpdate, _impl_.update_type_.batch_), _Internal::kOneofCaseOffset + 0, 2, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::market_plant::v1::SnapshotUpdate>()},
+      {::_pbi::TcParser::GetTable<::market_plant::v1::IncrementalUpdate>()},
+      {::_pbi::TcParser::GetTable<::market_plant::v1::IncrementalBatch>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void OrderBookUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:market_plant.v1.OrderBookUpdate)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.instrument_id_ = 0u;
+  clear_update_type();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL OrderBookUpdate::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const OrderBookUpdate& this_ = static_cast<const OrderBookUpdate&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL OrderBookUpdate::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const OrderBookUpdate& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.OrderBookUpdate)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // uint32 instrument_id = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (this_._internal_instrument_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          1, this_._internal_instrument_id(), target);
+    }
+  }
+
+  switch (this_.update_type_case()) {
+    case kSnapshot: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          2, *this_._impl_.update_type_.snapshot_, this_._impl_.update_type_.snapshot_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kIncremental: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          3, *this_._impl_.update_type_.incremental_, this_._impl_.update_type_.incremental_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kBatch: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          4, *this_._impl_.update_type_.batch_, this_._impl_.update_type_.batch_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    default:
+      break;
+  }
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.OrderBookUpdate)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t OrderBookUpdate::ByteSizeLong(const MessageLite& base) {
+  const OrderBookUpdate& this_ = static_cast<const OrderBookUpdate&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t OrderBookUpdate::ByteSizeLong() const {
+  const OrderBookUpdate& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.OrderBookUpdate)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+   {
+    // uint32 instrument_id = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (this_._internal_instrument_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_instrument_id());
+      }
+    }
+  }
+  switch (this_.update_type_case()) {
+    // .market_plant.v1.SnapshotUpdate snapshot = 2;
+    case kSnapshot: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.snapshot_);
+      break;
+    }
+    // .market_plant.v1.IncrementalUpdate incremental = 3;
+    case kIncremental: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.incremental_);
+      break;
+    }
+    // .market_plant.v1.IncrementalBatch batch = 4;
+    case kBatch: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.batch_);
+      break;
+    }
+    case UPDATE_TYPE_NOT_SET: {
+      break;
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void OrderBookUpdate::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<OrderBookUpdate*>(&to_msg);
+  auto& from = static_cast<const OrderBookUpdate&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.OrderBookUpdate)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (from._internal_instrument_id() != 0) {
+      _this->_impl_.instrument_id_ = from._impl_.instrument_id_;
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  if (const uint32_t oneof_from_case =
+          from._impl_._oneof_case_[0]) {
+    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
+    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
+    if (oneof_needs_init) {
+      if (oneof_to_case != 0) {
+        _this->clear_update_type();
+      }
+      _this->_impl_._oneof_case_[0] = oneof_from_case;
+    }
+
+    switch (oneof_from_case) {
+      case kSnapshot: {
+        if (oneof_needs_init) {
+          _this->_impl_.update_type_.snapshot_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.snapshot_);
+        } else {
+          _this->_impl_.update_type_.snapshot_->MergeFrom(*from._impl_.update_type_.snapshot_);
+        }
+        break;
+      }
+      case kIncremental: {
+        if (oneof_needs_init) {
+          _this->_impl_.update_type_.incremental_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.incremental_);
+        } else {
+          _this->_impl_.update_type_.incremental_->MergeFrom(*from._impl_.update_type_.incremental_);
+        }
+        break;
+      }
+      case kBatch: {
+        if (oneof_needs_init) {
+          _this->_impl_.update_type_.batch_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.update_type_.batch_);
+        } else {
+          _this->_impl_.update_type_.batch_->MergeFrom(*from._impl_.update_type_.batch_);
+        }
+        break;
+      }
+      case UPDATE_TYPE_NOT_SET:
+        break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void OrderBookUpdate::CopyFrom(const OrderBookUpdate& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.OrderBookUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void OrderBookUpdate::InternalSwap(OrderBookUpdate* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.instrument_id_, other->_impl_.instrument_id_);
+  swap(_impl_.update_type_, other->_impl_.update_type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata OrderBookUpdate::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class InstrumentSnapshot::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<InstrumentSnapshot>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_._has_bits_);
+};
+
+InstrumentSnapshot::InstrumentSnapshot(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, InstrumentSnapshot_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:market_plant.v1.InstrumentSnapshot)
+}
+PROTOBUF_NDEBUG_INLINE InstrumentSnapshot::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::market_plant::v1::InstrumentSnapshot& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+InstrumentSnapshot::InstrumentSnapshot(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const InstrumentSnapshot& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, InstrumentSnapshot_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  InstrumentSnapshot* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.snapshot_ = (CheckHasBit(cached_has_bits, 0x00000001U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.snapshot_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, version_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, version_),
+           offsetof(Impl_, instrument_id_) -
+               offsetof(Impl_, version_) +
+               sizeof(Impl_::instrument_id_));
+
+  // @@protoc_insertion_point(copy_constructor:market_plant.v1.InstrumentSnapshot)
+}
+PROTOBUF_NDEBUG_INLINE InstrumentSnapshot::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0} {}
+
+inline void InstrumentSnapshot::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, snapshot_),
+           0,
+           offsetof(Impl_, instrument_id_) -
+               offsetof(Impl_, snapshot_) +
+               sizeof(Impl_::instrument_id_));
+}
+InstrumentSnapshot::~InstrumentSnapshot() {
+  // @@protoc_insertion_point(destructor:market_plant.v1.InstrumentSnapshot)
+  SharedDtor(*this);
+}
+inline void InstrumentSnapshot::SharedDtor(MessageLite& self) {
+  InstrumentSnapshot& this_ = static_cast<InstrumentSnapshot&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  delete this_._impl_.snapshot_;
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL InstrumentSnapshot::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) InstrumentSnapshot(arena);
+}
+constexpr auto InstrumentSnapshot::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(InstrumentSnapshot),
+                                            alignof(InstrumentSnapshot));
+}
+constexpr auto InstrumentSnapshot::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_InstrumentSnapshot_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &InstrumentSnapshot::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<InstrumentSnapshot>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &InstrumentSnapshot::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<InstrumentSnapshot>(), &InstrumentSnapshot::ByteSizeLong,
+              &InstrumentSnapshot::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_._cached_size_),
+          false,
+      },
+      &InstrumentSnapshot::kDescriptorMethods,
+      &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull InstrumentSnapshot_class_data_ =
+        InstrumentSnapshot::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+InstrumentSnapshot::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&InstrumentSnapshot_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(InstrumentSnapshot_class_data_.tc_table);
+  return InstrumentSnapshot_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 1, 0, 2>
+InstrumentSnapshot::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    InstrumentSnapshot_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::market_plant::v1::InstrumentSnapshot>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // uint32 instrument_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(InstrumentSnapshot, _impl_.instrument_id_), 2>(),
+     {8, 2, 0,
+      PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.instrument_id_)}},
+    // uint64 version = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(InstrumentSnapshot, _impl_.version_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.version_)}},
+    // .market_plant.v1.SnapshotUpdate snapshot = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 0, 0,
+      PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.snapshot_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // uint32 instrument_id = 1;
+    {PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.instrument_id_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // uint64 version = 2;
+    {PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.version_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // .market_plant.v1.SnapshotUpdate snapshot = 3;
+    {PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.snapshot_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::market_plant::v1::SnapshotUpdate>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void InstrumentSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:market_plant.v1.InstrumentSnapshot)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    ABSL_DCHECK(_impl_.snapshot_ != nullptr);
+    _impl_.snapshot_->Clear();
+  }
+  if (BatchCheckHasBit(cached_has_bits, 0x00000006U)) {
+    ::memset(&_impl_.version_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.instrument_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.instrument_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL InstrumentSnapshot::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const InstrumentSnapshot& this_ = static_cast<const InstrumentSnapshot&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL InstrumentSnapshot::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const InstrumentSnapshot& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.InstrumentSnapshot)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // uint32 instrument_id = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_instrument_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          1, this_._internal_instrument_id(), target);
+    }
+  }
+
+  // uint64 version = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_version() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          2, this_._internal_version(), target);
+    }
+  }
+
+  // .market_plant.v1.SnapshotUpdate snapshot = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, *this_._impl_.snapshot_, this_._impl_.snapshot_->GetCachedSize(), target,
+        stream);
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.InstrumentSnapshot)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t InstrumentSnapshot::ByteSizeLong(const MessageLite& base) {
+  const InstrumentSnapshot& this_ = static_cast<const InstrumentSnapshot&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t InstrumentSnapshot::ByteSizeLong() const {
+  const InstrumentSnapshot& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.InstrumentSnapshot)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    // .market_plant.v1.SnapshotUpdate snapshot = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.snapshot_);
+    }
+    // uint64 version = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_version() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_version());
+      }
+    }
+    // uint32 instrument_id = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_instrument_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_instrument_id());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void InstrumentSnapshot::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<InstrumentSnapshot*>(&to_msg);
+  auto& from = static_cast<const InstrumentSnapshot&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.InstrumentSnapshot)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      ABSL_DCHECK(from._impl_.snapshot_ != nullptr);
+      if (_this->_impl_.snapshot_ == nullptr) {
+        _this->_impl_.snapshot_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.snapshot_);
+      } else {
+        _this->_impl_.snapshot_->MergeFrom(*from._impl_.snapshot_);
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_version() != 0) {
+        _this->_impl_.version_ = from._impl_.version_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_instrument_id() != 0) {
+        _this->_impl_.instrument_id_ = from._impl_.instrument_id_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void InstrumentSnapshot::CopyFrom(const InstrumentSnapshot& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.InstrumentSnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void InstrumentSnapshot::InternalSwap(InstrumentSnapshot* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.instrument_id_)
+      + sizeof(InstrumentSnapshot::_impl_.instrument_id_)
+      - PROTOBUF_FIELD_OFFSET(InstrumentSnapshot, _impl_.snapshot_)>(
+          reinterpret_cast<char*>(&_impl_.snapshot_),
+          reinterpret_cast<char*>(&other->_impl_.snapshot_));
+}
+
+::google::protobuf::Metadata InstrumentSnapshot::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class SnapshotResponse::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<SnapshotResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(SnapshotResponse, _impl_._has_bits_);
+};
+
+SnapshotResponse::SnapshotResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SnapshotResponse_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:market_plant.v1.SnapshotResponse)
+}
+PROTOBUF_NDEBUG_INLINE SnapshotResponse::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::market_plant::v1::SnapshotResponse& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        snapshots_{visibility, arena, from.snapshots_} {}
+
+SnapshotResponse::SnapshotResponse(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const SnapshotResponse& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SnapshotResponse_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SnapshotResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:market_plant.v1.SnapshotResponse)
+}
+PROTOBUF_NDEBUG_INLINE SnapshotResponse::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        snapshots_{visibility, arena} {}
+
+inline void SnapshotResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+SnapshotResponse::~SnapshotResponse() {
+  // @@protoc_insertion_point(destructor:market_plant.v1.SnapshotResponse)
+  SharedDtor(*this);
+}
+inline void SnapshotResponse::SharedDtor(MessageLite& self) {
+  SnapshotResponse& this_ = static_cast<SnapshotResponse&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL SnapshotResponse::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) SnapshotResponse(arena);
+}
+constexpr auto SnapshotResponse::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(SnapshotResponse, _impl_.snapshots_) +
+          decltype(SnapshotResponse::_impl_.snapshots_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(SnapshotResponse), alignof(SnapshotResponse), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&SnapshotResponse::PlacementNew_,
+                                 sizeof(SnapshotResponse),
+                                 alignof(SnapshotResponse));
+  }
+}
+constexpr auto SnapshotResponse::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_SnapshotResponse_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &SnapshotResponse::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<SnapshotResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &SnapshotResponse::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<SnapshotResponse>(), &SnapshotResponse::ByteSizeLong,
+              &SnapshotResponse::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(SnapshotResponse, _impl_._cached_size_),
+          false,
+      },
+      &SnapshotResponse::kDescriptorMethods,
+      &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull SnapshotResponse_class_data_ =
+        SnapshotResponse::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+SnapshotResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&SnapshotResponse_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(SnapshotResponse_class_data_.tc_table);
+  return SnapshotResponse_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+SnapshotResponse::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(SnapshotResponse, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    SnapshotResponse_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::market_plant::v1::SnapshotResponse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .market_plant.v1.InstrumentSnapshot snapshots = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(SnapshotResponse, _impl_.snapshots_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .market_plant.v1.InstrumentSnapshot snapshots = 1;
+    {PROTOBUF_FIELD_OFFSET(SnapshotResponse, _impl_.snapshots_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::market_plant::v1::InstrumentSnapshot>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void SnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:market_plant.v1.SnapshotResponse)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.snapshots_.Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL SnapshotResponse::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const SnapshotResponse& this_ = static_cast<const SnapshotResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL SnapshotResponse::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const SnapshotResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.SnapshotResponse)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // repeated .market_plant.v1.InstrumentSnapshot snapshots = 1;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_snapshots_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_snapshots().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              1, repfield, repfield.GetCachedSize(),
+              target, stream);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.SnapshotResponse)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t SnapshotResponse::ByteSizeLong(const MessageLite& base) {
+  const SnapshotResponse& this_ = static_cast<const SnapshotResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t SnapshotResponse::ByteSizeLong() const {
+  const SnapshotResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.SnapshotResponse)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+   {
+    // repeated .market_plant.v1.InstrumentSnapshot snapshots = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_snapshots_size();
+      for (const auto& msg : this_._internal_snapshots()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
       }
-      case UPDATE_TYPE_NOT_SET:
-        break;
     }
   }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void SnapshotResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<SnapshotResponse*>(&to_msg);
+  auto& from = static_cast<const SnapshotResponse&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.SnapshotResponse)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _this->_internal_mutable_snapshots()->InternalMergeFromWithArena(
+        ::google::protobuf::MessageLite::internal_visibility(), arena,
+        from._internal_snapshots());
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 }
 
-void OrderBookUpdate::CopyFrom(const OrderBookUpdate& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.OrderBookUpdate)
+void SnapshotResponse::CopyFrom(const SnapshotResponse& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.SnapshotResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void OrderBookUpdate::InternalSwap(OrderBookUpdate* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void SnapshotResponse::InternalSwap(SnapshotResponse* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.instrument_id_, other->_impl_.instrument_id_);
-  swap(_impl_.update_type_, other->_impl_.update_type_);
-  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+  _impl_.snapshots_.InternalSwap(&other->_impl_.snapshots_);
 }
 
-::google::protobuf::Metadata OrderBookUpdate::GetMetadata() const {
+::google::protobuf::Metadata SnapshotResponse::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
@@ -2399,8 +3601,331 @@ void InstrumentIds::InternalSwap(InstrumentIds* PROTOBUF_RESTRICT PROTOBUF_NONNU
 }
 // ===================================================================
 
+class SubscriptionOptions::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<SubscriptionOptions>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_._has_bits_);
+};
+
+SubscriptionOptions::SubscriptionOptions(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SubscriptionOptions_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:market_plant.v1.SubscriptionOptions)
+}
+SubscriptionOptions::SubscriptionOptions(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const SubscriptionOptions& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SubscriptionOptions_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(from._impl_) {
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+PROTOBUF_NDEBUG_INLINE SubscriptionOptions::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0} {}
+
+inline void SubscriptionOptions::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, absolute_quantity_),
+           0,
+           offsetof(Impl_, conflate_backlog_) -
+               offsetof(Impl_, absolute_quantity_) +
+               sizeof(Impl_::conflate_backlog_));
+}
+SubscriptionOptions::~SubscriptionOptions() {
+  // @@protoc_insertion_point(destructor:market_plant.v1.SubscriptionOptions)
+  SharedDtor(*this);
+}
+inline void SubscriptionOptions::SharedDtor(MessageLite& self) {
+  SubscriptionOptions& this_ = static_cast<SubscriptionOptions&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL SubscriptionOptions::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) SubscriptionOptions(arena);
+}
+constexpr auto SubscriptionOptions::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(SubscriptionOptions),
+                                            alignof(SubscriptionOptions));
+}
+constexpr auto SubscriptionOptions::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_SubscriptionOptions_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &SubscriptionOptions::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<SubscriptionOptions>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &SubscriptionOptions::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<SubscriptionOptions>(), &SubscriptionOptions::ByteSizeLong,
+              &SubscriptionOptions::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_._cached_size_),
+          false,
+      },
+      &SubscriptionOptions::kDescriptorMethods,
+      &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull SubscriptionOptions_class_data_ =
+        SubscriptionOptions::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+SubscriptionOptions::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&SubscriptionOptions_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(SubscriptionOptions_class_data_.tc_table);
+  return SubscriptionOptions_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2>
+SubscriptionOptions::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    SubscriptionOptions_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::market_plant::v1::SubscriptionOptions>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // bool absolute_quantity = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(SubscriptionOptions, _impl_.absolute_quantity_), 0>(),
+     {8, 0, 0,
+      PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.absolute_quantity_)}},
+    // bool batch_updates = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(SubscriptionOptions, _impl_.batch_updates_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.batch_updates_)}},
+    // uint32 conflate_backlog = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SubscriptionOptions, _impl_.conflate_backlog_), 2>(),
+     {24, 2, 0,
+      PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.conflate_backlog_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool absolute_quantity = 1;
+    {PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.absolute_quantity_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // bool batch_updates = 2;
+    {PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.batch_updates_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // uint32 conflate_backlog = 3;
+    {PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.conflate_backlog_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void SubscriptionOptions::Clear() {
+// @@protoc_insertion_point(message_clear_start:market_plant.v1.SubscriptionOptions)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    ::memset(&_impl_.absolute_quantity_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.conflate_backlog_) -
+        reinterpret_cast<char*>(&_impl_.absolute_quantity_)) + sizeof(_impl_.conflate_backlog_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL SubscriptionOptions::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const SubscriptionOptions& this_ = static_cast<const SubscriptionOptions&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL SubscriptionOptions::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const SubscriptionOptions& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.SubscriptionOptions)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // bool absolute_quantity = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (this_._internal_absolute_quantity() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          1, this_._internal_absolute_quantity(), target);
+    }
+  }
+
+  // bool batch_updates = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_batch_updates() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          2, this_._internal_batch_updates(), target);
+    }
+  }
+
+  // uint32 conflate_backlog = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_conflate_backlog() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          3, this_._internal_conflate_backlog(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.SubscriptionOptions)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t SubscriptionOptions::ByteSizeLong(const MessageLite& base) {
+  const SubscriptionOptions& this_ = static_cast<const SubscriptionOptions&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t SubscriptionOptions::ByteSizeLong() const {
+  const SubscriptionOptions& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.SubscriptionOptions)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    // bool absolute_quantity = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (this_._internal_absolute_quantity() != 0) {
+        total_size += 2;
+      }
+    }
+    // bool batch_updates = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_batch_updates() != 0) {
+        total_size += 2;
+      }
+    }
+    // uint32 conflate_backlog = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_conflate_backlog() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_conflate_backlog());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void SubscriptionOptions::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<SubscriptionOptions*>(&to_msg);
+  auto& from = static_cast<const SubscriptionOptions&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.SubscriptionOptions)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (from._internal_absolute_quantity() != 0) {
+        _this->_impl_.absolute_quantity_ = from._impl_.absolute_quantity_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_batch_updates() != 0) {
+        _this->_impl_.batch_updates_ = from._impl_.batch_updates_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_conflate_backlog() != 0) {
+        _this->_impl_.conflate_backlog_ = from._impl_.conflate_backlog_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void SubscriptionOptions::CopyFrom(const SubscriptionOptions& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.SubscriptionOptions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void SubscriptionOptions::InternalSwap(SubscriptionOptions* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.conflate_backlog_)
+      + sizeof(SubscriptionOptions::_impl_.conflate_backlog_)
+      - PROTOBUF_FIELD_OFFSET(SubscriptionOptions, _impl_.absolute_quantity_)>(
+          reinterpret_cast<char*>(&_impl_.absolute_quantity_),
+          reinterpret_cast<char*>(&other->_impl_.absolute_quantity_));
+}
+
+::google::protobuf::Metadata SubscriptionOptions::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
 class Subscription::_Internal {
  public:
+  using HasBits =
+      decltype(::std::declval<Subscription>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(Subscription, _impl_._has_bits_);
   static constexpr ::int32_t kOneofCaseOffset =
       PROTOBUF_FIELD_OFFSET(::market_plant::v1::Subscription, _impl_._oneof_case_);
 };
@@ -2444,8 +3969,9 @@ PROTOBUF_NDEBUG_INLINE Subscription::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
     [[maybe_unused]] const ::market_plant::v1::Subscription& from_msg)
-      : action_{},
+      : _has_bits_{from._has_bits_},
         _cached_size_{0},
+        action_{},
         _oneof_case_{from._oneof_case_[0]} {}
 
 Subscription::Subscription(
@@ -2461,6 +3987,10 @@ Subscription::Subscription(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.options_ = (CheckHasBit(cached_has_bits, 0x00000001U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.options_)
+                : nullptr;
   switch (action_case()) {
     case ACTION_NOT_SET:
       break;
@@ -2477,12 +4007,13 @@ Subscription::Subscription(
 PROTOBUF_NDEBUG_INLINE Subscription::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : action_{},
-        _cached_size_{0},
+      : _cached_size_{0},
+        action_{},
         _oneof_case_{} {}
 
 inline void Subscription::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.options_ = {};
 }
 Subscription::~Subscription() {
   // @@protoc_insertion_point(destructor:market_plant.v1.Subscription)
@@ -2495,6 +4026,7 @@ inline void Subscription::SharedDtor(MessageLite& self) {
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
+  delete this_._impl_.options_;
   if (this_.has_action()) {
     this_.clear_action();
   }
@@ -2572,17 +4104,17 @@ Subscription::GetClassData() const {
   return Subscription_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 2, 2, 0, 2>
+const ::_pbi::TcParseTable<0, 3, 3, 0, 2>
 Subscription::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(Subscription, _impl_._has_bits_),
     0, // no _extensions_
-    2, 0,  // max_field_number, fast_idx_mask
+    3, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     Subscription_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -2591,7 +4123,10 @@ Subscription::_table_ = {
     ::_pbi::TcParser::GetTable<::market_plant::v1::Subscription>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // .market_plant.v1.SubscriptionOptions options = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 0, 2,
+      PROTOBUF_FIELD_OFFSET(Subscription, _impl_.options_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -2599,10 +4134,13 @@ Subscription::_table_ = {
     {PROTOBUF_FIELD_OFFSET(Subscription, _impl_.action_.subscribe_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
     // .market_plant.v1.InstrumentIds unsubscribe = 2;
     {PROTOBUF_FIELD_OFFSET(Subscription, _impl_.action_.unsubscribe_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .market_plant.v1.SubscriptionOptions options = 3;
+    {PROTOBUF_FIELD_OFFSET(Subscription, _impl_.options_), _Internal::kHasBitsOffset + 0, 2, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::market_plant::v1::InstrumentIds>()},
       {::_pbi::TcParser::GetTable<::market_plant::v1::InstrumentIds>()},
+      {::_pbi::TcParser::GetTable<::market_plant::v1::SubscriptionOptions>()},
   }},
   {{
   }},
@@ -2614,7 +4152,13 @@ PROTOBUF_NOINLINE void Subscription::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    ABSL_DCHECK(_impl_.options_ != nullptr);
+    _impl_.options_->Clear();
+  }
   clear_action();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -2636,6 +4180,7 @@ PROTOBUF_NOINLINE void Subscription::Clear() {
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
+  cached_has_bits = this_._impl_._has_bits_[0];
   switch (this_.action_case()) {
     case kSubscribe: {
       target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
@@ -2652,6 +4197,13 @@ PROTOBUF_NOINLINE void Subscription::Clear() {
     default:
       break;
   }
+  // .market_plant.v1.SubscriptionOptions options = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, *this_._impl_.options_, this_._impl_.options_->GetCachedSize(), target,
+        stream);
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -2675,6 +4227,14 @@ PROTOBUF_NOINLINE void Subscription::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
+   {
+    // .market_plant.v1.SubscriptionOptions options = 3;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.options_);
+    }
+  }
   switch (this_.action_case()) {
     // .market_plant.v1.InstrumentIds subscribe = 1;
     case kSubscribe: {
@@ -2710,6 +4270,16 @@ void Subscription::MergeImpl(::google::protobuf::MessageLite& to_msg,
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    ABSL_DCHECK(from._impl_.options_ != nullptr);
+    if (_this->_impl_.options_ == nullptr) {
+      _this->_impl_.options_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.options_);
+    } else {
+      _this->_impl_.options_->MergeFrom(*from._impl_.options_);
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
   if (const uint32_t oneof_from_case =
           from._impl_._oneof_case_[0]) {
     const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
@@ -2757,6 +4327,8 @@ void Subscription::CopyFrom(const Subscription& from) {
 void Subscription::InternalSwap(Subscription* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.options_, other->_impl_.options_);
   swap(_impl_.action_, other->_impl_.action_);
   swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
@@ -3070,6 +4642,290 @@ void SubscriberInitialization::InternalSwap(SubscriberInitialization* PROTOBUF_R
 }
 // ===================================================================
 
+class UpdateBatch::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<UpdateBatch>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(UpdateBatch, _impl_._has_bits_);
+};
+
+UpdateBatch::UpdateBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, UpdateBatch_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:market_plant.v1.UpdateBatch)
+}
+PROTOBUF_NDEBUG_INLINE UpdateBatch::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::market_plant::v1::UpdateBatch& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        updates_{visibility, arena, from.updates_} {}
+
+UpdateBatch::UpdateBatch(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const UpdateBatch& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, UpdateBatch_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  UpdateBatch* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:market_plant.v1.UpdateBatch)
+}
+PROTOBUF_NDEBUG_INLINE UpdateBatch::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        updates_{visibility, arena} {}
+
+inline void UpdateBatch::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+UpdateBatch::~UpdateBatch() {
+  // @@protoc_insertion_point(destructor:market_plant.v1.UpdateBatch)
+  SharedDtor(*this);
+}
+inline void UpdateBatch::SharedDtor(MessageLite& self) {
+  UpdateBatch& this_ = static_cast<UpdateBatch&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL UpdateBatch::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) UpdateBatch(arena);
+}
+constexpr auto UpdateBatch::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(UpdateBatch, _impl_.updates_) +
+          decltype(UpdateBatch::_impl_.updates_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(UpdateBatch), alignof(UpdateBatch), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&UpdateBatch::PlacementNew_,
+                                 sizeof(UpdateBatch),
+                                 alignof(UpdateBatch));
+  }
+}
+constexpr auto UpdateBatch::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_UpdateBatch_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &UpdateBatch::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<UpdateBatch>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &UpdateBatch::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<UpdateBatch>(), &UpdateBatch::ByteSizeLong,
+              &UpdateBatch::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(UpdateBatch, _impl_._cached_size_),
+          false,
+      },
+      &UpdateBatch::kDescriptorMethods,
+      &descriptor_table_market_5fplant_2fmarket_5fplant_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull UpdateBatch_class_data_ =
+        UpdateBatch::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+UpdateBatch::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&UpdateBatch_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(UpdateBatch_class_data_.tc_table);
+  return UpdateBatch_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+UpdateBatch::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(UpdateBatch, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967293,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    UpdateBatch_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::market_plant::v1::UpdateBatch>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .market_plant.v1.OrderBookUpdate updates = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 0, 0,
+      PROTOBUF_FIELD_OFFSET(UpdateBatch, _impl_.updates_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .market_plant.v1.OrderBookUpdate updates = 2;
+    {PROTOBUF_FIELD_OFFSET(UpdateBatch, _impl_.updates_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::market_plant::v1::OrderBookUpdate>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void UpdateBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:market_plant.v1.UpdateBatch)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.updates_.Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL UpdateBatch::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const UpdateBatch& this_ = static_cast<const UpdateBatch&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL UpdateBatch::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const UpdateBatch& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:market_plant.v1.UpdateBatch)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // repeated .market_plant.v1.OrderBookUpdate updates = 2;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_updates_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_updates().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              2, repfield, repfield.GetCachedSize(),
+              target, stream);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:market_plant.v1.UpdateBatch)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t UpdateBatch::ByteSizeLong(const MessageLite& base) {
+  const UpdateBatch& this_ = static_cast<const UpdateBatch&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t UpdateBatch::ByteSizeLong() const {
+  const UpdateBatch& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:market_plant.v1.UpdateBatch)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+   {
+    // repeated .market_plant.v1.OrderBookUpdate updates = 2;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_updates_size();
+      for (const auto& msg : this_._internal_updates()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void UpdateBatch::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<UpdateBatch*>(&to_msg);
+  auto& from = static_cast<const UpdateBatch&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:market_plant.v1.UpdateBatch)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _this->_internal_mutable_updates()->InternalMergeFromWithArena(
+        ::google::protobuf::MessageLite::internal_visibility(), arena,
+        from._internal_updates());
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void UpdateBatch::CopyFrom(const UpdateBatch& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:market_plant.v1.UpdateBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void UpdateBatch::InternalSwap(UpdateBatch* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+}
+
+::google::protobuf::Metadata UpdateBatch::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
 class StreamResponse::_Internal {
  public:
   static constexpr ::int32_t kOneofCaseOffset =
@@ -3102,6 +4958,19 @@ void StreamResponse::set_allocated_update(::market_plant::v1::OrderBookUpdate* P
   }
   // @@protoc_insertion_point(field_set_allocated:market_plant.v1.StreamResponse.update)
 }
+void StreamResponse::set_allocated_batch(::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE batch) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_payload();
+  if (batch) {
+    ::google::protobuf::Arena* submessage_arena = batch->GetArena();
+    if (message_arena != submessage_arena) {
+      batch = ::google::protobuf::internal::GetOwnedMessage(message_arena, batch, submessage_arena);
+    }
+    set_has_batch();
+    _impl_.payload_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.StreamResponse.batch)
+}
 StreamResponse::StreamResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, StreamResponse_class_data_.base()) {
@@ -3141,6 +5010,9 @@ StreamResponse::StreamResponse(
       case kUpdate:
         _impl_.payload_.update_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.update_);
         break;
+      case kBatch:
+        _impl_.payload_.batch_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.batch_);
+        break;
   }
 
   // @@protoc_insertion_point(copy_constructor:market_plant.v1.StreamResponse)
@@ -3192,6 +5064,14 @@ void StreamResponse::clear_payload() {
       }
       break;
     }
+    case kBatch: {
+      if (GetArena() == nullptr) {
+        delete _impl_.payload_.batch_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.batch_);
+      }
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -3243,17 +5123,17 @@ StreamResponse::GetClassData() const {
   return StreamResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 2, 2, 0, 2>
+const ::_pbi::TcParseTable<0, 3, 3, 0, 2>
 StreamResponse::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 0,  // max_field_number, fast_idx_mask
+    3, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
+    3,  // num_field_entries
+    3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     StreamResponse_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -3270,10 +5150,13 @@ StreamResponse::_table_ = {
     {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.payload_.init_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
     // .market_plant.v1.OrderBookUpdate update = 2;
     {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.payload_.update_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .market_plant.v1.UpdateBatch batch = 3;
+    {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.payload_.batch_), _Internal::kOneofCaseOffset + 0, 2, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::market_plant::v1::SubscriberInitialization>()},
       {::_pbi::TcParser::GetTable<::market_plant::v1::OrderBookUpdate>()},
+      {::_pbi::TcParser::GetTable<::market_plant::v1::UpdateBatch>()},
   }},
   {{
   }},
@@ -3320,6 +5203,12 @@ PROTOBUF_NOINLINE void StreamResponse::Clear() {
           stream);
       break;
     }
+    case kBatch: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          3, *this_._impl_.payload_.batch_, this_._impl_.payload_.batch_->GetCachedSize(), target,
+          stream);
+      break;
+    }
     default:
       break;
   }
@@ -3359,6 +5248,12 @@ PROTOBUF_NOINLINE void StreamResponse::Clear() {
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.update_);
       break;
     }
+    // .market_plant.v1.UpdateBatch batch = 3;
+    case kBatch: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.batch_);
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -3409,6 +5304,14 @@ void StreamResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
         }
         break;
       }
+      case kBatch: {
+        if (oneof_needs_init) {
+          _this->_impl_.payload_.batch_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.batch_);
+        } else {
+          _this->_impl_.payload_.batch_->MergeFrom(*from._impl_.payload_.batch_);
+        }
+        break;
+      }
       case PAYLOAD_NOT_SET:
         break;
     }
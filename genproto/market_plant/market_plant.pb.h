@@ -60,6 +60,10 @@ enum OrderBookEventType : int;
 extern const uint32_t OrderBookEventType_internal_data_[];
 enum Side : int;
 extern const uint32_t Side_internal_data_[];
+class IncrementalBatch;
+struct IncrementalBatchDefaultTypeInternal;
+extern IncrementalBatchDefaultTypeInternal _IncrementalBatch_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull IncrementalBatch_class_data_;
 class IncrementalUpdate;
 struct IncrementalUpdateDefaultTypeInternal;
 extern IncrementalUpdateDefaultTypeInternal _IncrementalUpdate_default_instance_;
@@ -68,6 +72,10 @@ class InstrumentIds;
 struct InstrumentIdsDefaultTypeInternal;
 extern InstrumentIdsDefaultTypeInternal _InstrumentIds_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull InstrumentIds_class_data_;
+class InstrumentSnapshot;
+struct InstrumentSnapshotDefaultTypeInternal;
+extern InstrumentSnapshotDefaultTypeInternal _InstrumentSnapshot_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull InstrumentSnapshot_class_data_;
 class Level;
 struct LevelDefaultTypeInternal;
 extern LevelDefaultTypeInternal _Level_default_instance_;
@@ -80,6 +88,10 @@ class OrderBookUpdate;
 struct OrderBookUpdateDefaultTypeInternal;
 extern OrderBookUpdateDefaultTypeInternal _OrderBookUpdate_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull OrderBookUpdate_class_data_;
+class SnapshotResponse;
+struct SnapshotResponseDefaultTypeInternal;
+extern SnapshotResponseDefaultTypeInternal _SnapshotResponse_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull SnapshotResponse_class_data_;
 class SnapshotUpdate;
 struct SnapshotUpdateDefaultTypeInternal;
 extern SnapshotUpdateDefaultTypeInternal _SnapshotUpdate_default_instance_;
@@ -96,6 +108,14 @@ class Subscription;
 struct SubscriptionDefaultTypeInternal;
 extern SubscriptionDefaultTypeInternal _Subscription_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull Subscription_class_data_;
+class SubscriptionOptions;
+struct SubscriptionOptionsDefaultTypeInternal;
+extern SubscriptionOptionsDefaultTypeInternal _SubscriptionOptions_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull SubscriptionOptions_class_data_;
+class UpdateBatch;
+struct UpdateBatchDefaultTypeInternal;
+extern UpdateBatchDefaultTypeInternal _UpdateBatch_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull UpdateBatch_class_data_;
 class UpdateSubscriptionRequest;
 struct UpdateSubscriptionRequestDefaultTypeInternal;
 extern UpdateSubscriptionRequestDefaultTypeInternal _UpdateSubscriptionRequest_default_instance_;
@@ -156,6 +176,7 @@ enum OrderBookEventType : int {
   EVENT_UNSPECIFIED = 0,
   ADD_LEVEL = 1,
   REDUCE_LEVEL = 2,
+  SET_LEVEL = 3,
   OrderBookEventType_INT_MIN_SENTINEL_DO_NOT_USE_ =
       ::std::numeric_limits<::int32_t>::min(),
   OrderBookEventType_INT_MAX_SENTINEL_DO_NOT_USE_ =
@@ -166,11 +187,11 @@ extern const uint32_t OrderBookEventType_internal_data_[];
 inline constexpr OrderBookEventType OrderBookEventType_MIN =
     static_cast<OrderBookEventType>(0);
 inline constexpr OrderBookEventType OrderBookEventType_MAX =
-    static_cast<OrderBookEventType>(2);
+    static_cast<OrderBookEventType>(3);
 inline bool OrderBookEventType_IsValid(int value) {
-  return 0 <= value && value <= 2;
+  return 0 <= value && value <= 3;
 }
-inline constexpr int OrderBookEventType_ARRAYSIZE = 2 + 1;
+inline constexpr int OrderBookEventType_ARRAYSIZE = 3 + 1;
 const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL OrderBookEventType_descriptor();
 template <typename T>
 const ::std::string& OrderBookEventType_Name(T value) {
@@ -181,7 +202,7 @@ const ::std::string& OrderBookEventType_Name(T value) {
 }
 template <>
 inline const ::std::string& OrderBookEventType_Name(OrderBookEventType value) {
-  return ::google::protobuf::internal::NameOfDenseEnum<OrderBookEventType_descriptor, 0, 2>(
+  return ::google::protobuf::internal::NameOfDenseEnum<OrderBookEventType_descriptor, 0, 3>(
       static_cast<int>(value));
 }
 inline bool OrderBookEventType_Parse(
@@ -195,6 +216,220 @@ inline bool OrderBookEventType_Parse(
 
 // -------------------------------------------------------------------
 
+class SubscriptionOptions final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:market_plant.v1.SubscriptionOptions) */ {
+ public:
+  inline SubscriptionOptions() : SubscriptionOptions(nullptr) {}
+  ~SubscriptionOptions() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(SubscriptionOptions* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(SubscriptionOptions));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR SubscriptionOptions(::google::protobuf::internal::ConstantInitialized);
+
+  inline SubscriptionOptions(const SubscriptionOptions& from) : SubscriptionOptions(nullptr, from) {}
+  inline SubscriptionOptions(SubscriptionOptions&& from) noexcept
+      : SubscriptionOptions(nullptr, ::std::move(from)) {}
+  inline SubscriptionOptions& operator=(const SubscriptionOptions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubscriptionOptions& operator=(SubscriptionOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscriptionOptions& default_instance() {
+    return *reinterpret_cast<const SubscriptionOptions*>(
+        &_SubscriptionOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 9;
+  friend void swap(SubscriptionOptions& a, SubscriptionOptions& b) { a.Swap(&b); }
+  inline void Swap(SubscriptionOptions* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscriptionOptions* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubscriptionOptions* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<SubscriptionOptions>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const SubscriptionOptions& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const SubscriptionOptions& from) { SubscriptionOptions::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(SubscriptionOptions* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "market_plant.v1.SubscriptionOptions"; }
+
+  explicit SubscriptionOptions(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  SubscriptionOptions(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const SubscriptionOptions& from);
+  SubscriptionOptions(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, SubscriptionOptions&& from) noexcept
+      : SubscriptionOptions(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kAbsoluteQuantityFieldNumber = 1,
+    kBatchUpdatesFieldNumber = 2,
+    kConflateBacklogFieldNumber = 3,
+  };
+  // bool absolute_quantity = 1;
+  void clear_absolute_quantity() ;
+  bool absolute_quantity() const;
+  void set_absolute_quantity(bool value);
+
+  private:
+  bool _internal_absolute_quantity() const;
+  void _internal_set_absolute_quantity(bool value);
+
+  public:
+  // bool batch_updates = 2;
+  void clear_batch_updates() ;
+  bool batch_updates() const;
+  void set_batch_updates(bool value);
+
+  private:
+  bool _internal_batch_updates() const;
+  void _internal_set_batch_updates(bool value);
+
+  public:
+  // uint32 conflate_backlog = 3;
+  void clear_conflate_backlog() ;
+  ::uint32_t conflate_backlog() const;
+  void set_conflate_backlog(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_conflate_backlog() const;
+  void _internal_set_conflate_backlog(::uint32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:market_plant.v1.SubscriptionOptions)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
+                                   0, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const SubscriptionOptions& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    bool absolute_quantity_;
+    bool batch_updates_;
+    ::uint32_t conflate_backlog_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fplant_2fmarket_5fplant_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull SubscriptionOptions_class_data_;
+// -------------------------------------------------------------------
+
 class SubscriberInitialization final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:market_plant.v1.SubscriberInitialization) */ {
  public:
@@ -250,7 +485,7 @@ class SubscriberInitialization final : public ::google::protobuf::Message
     return *reinterpret_cast<const SubscriberInitialization*>(
         &_SubscriberInitialization_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 7;
+  static constexpr int kIndexInFileMessages = 11;
   friend void swap(SubscriberInitialization& a, SubscriberInitialization& b) { a.Swap(&b); }
   inline void Swap(SubscriberInitialization* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -671,7 +906,7 @@ class InstrumentIds final : public ::google::protobuf::Message
     return *reinterpret_cast<const InstrumentIds*>(
         &_InstrumentIds_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 5;
+  static constexpr int kIndexInFileMessages = 8;
   friend void swap(InstrumentIds& a, InstrumentIds& b) { a.Swap(&b); }
   inline void Swap(InstrumentIds* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -875,7 +1110,7 @@ class Subscription final : public ::google::protobuf::Message
     kUnsubscribe = 2,
     ACTION_NOT_SET = 0,
   };
-  static constexpr int kIndexInFileMessages = 6;
+  static constexpr int kIndexInFileMessages = 10;
   friend void swap(Subscription& a, Subscription& b) { a.Swap(&b); }
   inline void Swap(Subscription* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -962,9 +1197,25 @@ class Subscription final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
+    kOptionsFieldNumber = 3,
     kSubscribeFieldNumber = 1,
     kUnsubscribeFieldNumber = 2,
   };
+  // .market_plant.v1.SubscriptionOptions options = 3;
+  bool has_options() const;
+  void clear_options() ;
+  const ::market_plant::v1::SubscriptionOptions& options() const;
+  [[nodiscard]] ::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE release_options();
+  ::market_plant::v1::SubscriptionOptions* PROTOBUF_NONNULL mutable_options();
+  void set_allocated_options(::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_options(::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE value);
+  ::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE unsafe_arena_release_options();
+
+  private:
+  const ::market_plant::v1::SubscriptionOptions& _internal_options() const;
+  ::market_plant::v1::SubscriptionOptions* PROTOBUF_NONNULL _internal_mutable_options();
+
+  public:
   // .market_plant.v1.InstrumentIds subscribe = 1;
   bool has_subscribe() const;
   private:
@@ -1013,8 +1264,8 @@ class Subscription final : public ::google::protobuf::Message
   inline bool has_action() const;
   inline void clear_has_action();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 2,
-                                   2, 0,
+  static const ::google::protobuf::internal::TcParseTable<0, 3,
+                                   3, 0,
                                    2>
       _table_;
 
@@ -1033,13 +1284,15 @@ class Subscription final : public ::google::protobuf::Message
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
         const Subscription& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE options_;
     union ActionUnion {
       constexpr ActionUnion() : _constinit_{} {}
       ::google::protobuf::internal::ConstantInitialized _constinit_;
       ::market_plant::v1::InstrumentIds* PROTOBUF_NULLABLE subscribe_;
       ::market_plant::v1::InstrumentIds* PROTOBUF_NULLABLE unsubscribe_;
     } action_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
     ::uint32_t _oneof_case_[1];
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -1312,7 +1565,7 @@ class UpdateSubscriptionRequest final : public ::google::protobuf::Message
     return *reinterpret_cast<const UpdateSubscriptionRequest*>(
         &_UpdateSubscriptionRequest_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 9;
+  static constexpr int kIndexInFileMessages = 14;
   friend void swap(UpdateSubscriptionRequest& a, UpdateSubscriptionRequest& b) { a.Swap(&b); }
   inline void Swap(UpdateSubscriptionRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -1892,30 +2145,30 @@ class IncrementalUpdate final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull IncrementalUpdate_class_data_;
 // -------------------------------------------------------------------
 
-class OrderBookUpdate final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:market_plant.v1.OrderBookUpdate) */ {
+class IncrementalBatch final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:market_plant.v1.IncrementalBatch) */ {
  public:
-  inline OrderBookUpdate() : OrderBookUpdate(nullptr) {}
-  ~OrderBookUpdate() PROTOBUF_FINAL;
+  inline IncrementalBatch() : IncrementalBatch(nullptr) {}
+  ~IncrementalBatch() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(OrderBookUpdate* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(IncrementalBatch* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderBookUpdate));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(IncrementalBatch));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR OrderBookUpdate(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR IncrementalBatch(::google::protobuf::internal::ConstantInitialized);
 
-  inline OrderBookUpdate(const OrderBookUpdate& from) : OrderBookUpdate(nullptr, from) {}
-  inline OrderBookUpdate(OrderBookUpdate&& from) noexcept
-      : OrderBookUpdate(nullptr, ::std::move(from)) {}
-  inline OrderBookUpdate& operator=(const OrderBookUpdate& from) {
+  inline IncrementalBatch(const IncrementalBatch& from) : IncrementalBatch(nullptr, from) {}
+  inline IncrementalBatch(IncrementalBatch&& from) noexcept
+      : IncrementalBatch(nullptr, ::std::move(from)) {}
+  inline IncrementalBatch& operator=(const IncrementalBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OrderBookUpdate& operator=(OrderBookUpdate&& from) noexcept {
+  inline IncrementalBatch& operator=(IncrementalBatch&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1943,18 +2196,13 @@ class OrderBookUpdate final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OrderBookUpdate& default_instance() {
-    return *reinterpret_cast<const OrderBookUpdate*>(
-        &_OrderBookUpdate_default_instance_);
+  static const IncrementalBatch& default_instance() {
+    return *reinterpret_cast<const IncrementalBatch*>(
+        &_IncrementalBatch_default_instance_);
   }
-  enum UpdateTypeCase {
-    kSnapshot = 2,
-    kIncremental = 3,
-    UPDATE_TYPE_NOT_SET = 0,
-  };
   static constexpr int kIndexInFileMessages = 4;
-  friend void swap(OrderBookUpdate& a, OrderBookUpdate& b) { a.Swap(&b); }
-  inline void Swap(OrderBookUpdate* PROTOBUF_NONNULL other) {
+  friend void swap(IncrementalBatch& a, IncrementalBatch& b) { a.Swap(&b); }
+  inline void Swap(IncrementalBatch* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1962,7 +2210,7 @@ class OrderBookUpdate final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OrderBookUpdate* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(IncrementalBatch* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1970,13 +2218,13 @@ class OrderBookUpdate final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  OrderBookUpdate* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<OrderBookUpdate>(arena);
+  IncrementalBatch* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<IncrementalBatch>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OrderBookUpdate& from);
+  void CopyFrom(const IncrementalBatch& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const OrderBookUpdate& from) { OrderBookUpdate::MergeImpl(*this, from); }
+  void MergeFrom(const IncrementalBatch& from) { IncrementalBatch::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -2012,17 +2260,17 @@ class OrderBookUpdate final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(OrderBookUpdate* PROTOBUF_NONNULL other);
+  void InternalSwap(IncrementalBatch* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "market_plant.v1.OrderBookUpdate"; }
+  static ::absl::string_view FullMessageName() { return "market_plant.v1.IncrementalBatch"; }
 
-  explicit OrderBookUpdate(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  OrderBookUpdate(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const OrderBookUpdate& from);
-  OrderBookUpdate(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, OrderBookUpdate&& from) noexcept
-      : OrderBookUpdate(arena) {
+  explicit IncrementalBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  IncrementalBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const IncrementalBatch& from);
+  IncrementalBatch(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, IncrementalBatch&& from) noexcept
+      : IncrementalBatch(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -2039,70 +2287,927 @@ class OrderBookUpdate final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kInstrumentIdFieldNumber = 1,
-    kSnapshotFieldNumber = 2,
-    kIncrementalFieldNumber = 3,
+    kUpdatesFieldNumber = 1,
+    kConflatedFieldNumber = 2,
   };
-  // uint32 instrument_id = 1;
-  void clear_instrument_id() ;
-  ::uint32_t instrument_id() const;
-  void set_instrument_id(::uint32_t value);
-
-  private:
-  ::uint32_t _internal_instrument_id() const;
-  void _internal_set_instrument_id(::uint32_t value);
-
-  public:
-  // .market_plant.v1.SnapshotUpdate snapshot = 2;
-  bool has_snapshot() const;
+  // repeated .market_plant.v1.OrderBookEventUpdate updates = 1;
+  int updates_size() const;
   private:
-  bool _internal_has_snapshot() const;
+  int _internal_updates_size() const;
 
   public:
-  void clear_snapshot() ;
-  const ::market_plant::v1::SnapshotUpdate& snapshot() const;
-  [[nodiscard]] ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE release_snapshot();
-  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL mutable_snapshot();
-  void set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value);
-  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE unsafe_arena_release_snapshot();
-
-  private:
-  const ::market_plant::v1::SnapshotUpdate& _internal_snapshot() const;
-  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL _internal_mutable_snapshot();
+  void clear_updates() ;
+  ::market_plant::v1::OrderBookEventUpdate* PROTOBUF_NONNULL mutable_updates(int index);
+  ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>* PROTOBUF_NONNULL mutable_updates();
 
-  public:
-  // .market_plant.v1.IncrementalUpdate incremental = 3;
-  bool has_incremental() const;
   private:
-  bool _internal_has_incremental() const;
-
+  const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>& _internal_updates() const;
+  ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>* PROTOBUF_NONNULL _internal_mutable_updates();
   public:
-  void clear_incremental() ;
-  const ::market_plant::v1::IncrementalUpdate& incremental() const;
-  [[nodiscard]] ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE release_incremental();
-  ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL mutable_incremental();
-  void set_allocated_incremental(::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_incremental(::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE value);
-  ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE unsafe_arena_release_incremental();
+  const ::market_plant::v1::OrderBookEventUpdate& updates(int index) const;
+  ::market_plant::v1::OrderBookEventUpdate* PROTOBUF_NONNULL add_updates();
+  const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>& updates() const;
+  // uint32 conflated = 2;
+  void clear_conflated() ;
+  ::uint32_t conflated() const;
+  void set_conflated(::uint32_t value);
 
   private:
-  const ::market_plant::v1::IncrementalUpdate& _internal_incremental() const;
-  ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL _internal_mutable_incremental();
+  ::uint32_t _internal_conflated() const;
+  void _internal_set_conflated(::uint32_t value);
 
   public:
-  void clear_update_type();
-  UpdateTypeCase update_type_case() const;
-  // @@protoc_insertion_point(class_scope:market_plant.v1.OrderBookUpdate)
+  // @@protoc_insertion_point(class_scope:market_plant.v1.IncrementalBatch)
  private:
   class _Internal;
-  void set_has_snapshot();
-  void set_has_incremental();
-  inline bool has_update_type() const;
-  inline void clear_has_update_type();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 3,
-                                   2, 0,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const IncrementalBatch& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::market_plant::v1::OrderBookEventUpdate > updates_;
+    ::uint32_t conflated_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fplant_2fmarket_5fplant_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull IncrementalBatch_class_data_;
+// -------------------------------------------------------------------
+
+class OrderBookUpdate final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:market_plant.v1.OrderBookUpdate) */ {
+ public:
+  inline OrderBookUpdate() : OrderBookUpdate(nullptr) {}
+  ~OrderBookUpdate() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(OrderBookUpdate* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderBookUpdate));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR OrderBookUpdate(::google::protobuf::internal::ConstantInitialized);
+
+  inline OrderBookUpdate(const OrderBookUpdate& from) : OrderBookUpdate(nullptr, from) {}
+  inline OrderBookUpdate(OrderBookUpdate&& from) noexcept
+      : OrderBookUpdate(nullptr, ::std::move(from)) {}
+  inline OrderBookUpdate& operator=(const OrderBookUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OrderBookUpdate& operator=(OrderBookUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OrderBookUpdate& default_instance() {
+    return *reinterpret_cast<const OrderBookUpdate*>(
+        &_OrderBookUpdate_default_instance_);
+  }
+  enum UpdateTypeCase {
+    kSnapshot = 2,
+    kIncremental = 3,
+    kBatch = 4,
+    UPDATE_TYPE_NOT_SET = 0,
+  };
+  static constexpr int kIndexInFileMessages = 5;
+  friend void swap(OrderBookUpdate& a, OrderBookUpdate& b) { a.Swap(&b); }
+  inline void Swap(OrderBookUpdate* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OrderBookUpdate* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OrderBookUpdate* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<OrderBookUpdate>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const OrderBookUpdate& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const OrderBookUpdate& from) { OrderBookUpdate::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(OrderBookUpdate* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "market_plant.v1.OrderBookUpdate"; }
+
+  explicit OrderBookUpdate(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  OrderBookUpdate(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const OrderBookUpdate& from);
+  OrderBookUpdate(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, OrderBookUpdate&& from) noexcept
+      : OrderBookUpdate(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kInstrumentIdFieldNumber = 1,
+    kSnapshotFieldNumber = 2,
+    kIncrementalFieldNumber = 3,
+    kBatchFieldNumber = 4,
+  };
+  // uint32 instrument_id = 1;
+  void clear_instrument_id() ;
+  ::uint32_t instrument_id() const;
+  void set_instrument_id(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_instrument_id() const;
+  void _internal_set_instrument_id(::uint32_t value);
+
+  public:
+  // .market_plant.v1.SnapshotUpdate snapshot = 2;
+  bool has_snapshot() const;
+  private:
+  bool _internal_has_snapshot() const;
+
+  public:
+  void clear_snapshot() ;
+  const ::market_plant::v1::SnapshotUpdate& snapshot() const;
+  [[nodiscard]] ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE release_snapshot();
+  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL mutable_snapshot();
+  void set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value);
+  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE unsafe_arena_release_snapshot();
+
+  private:
+  const ::market_plant::v1::SnapshotUpdate& _internal_snapshot() const;
+  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL _internal_mutable_snapshot();
+
+  public:
+  // .market_plant.v1.IncrementalUpdate incremental = 3;
+  bool has_incremental() const;
+  private:
+  bool _internal_has_incremental() const;
+
+  public:
+  void clear_incremental() ;
+  const ::market_plant::v1::IncrementalUpdate& incremental() const;
+  [[nodiscard]] ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE release_incremental();
+  ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL mutable_incremental();
+  void set_allocated_incremental(::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_incremental(::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE value);
+  ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE unsafe_arena_release_incremental();
+
+  private:
+  const ::market_plant::v1::IncrementalUpdate& _internal_incremental() const;
+  ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL _internal_mutable_incremental();
+
+  public:
+  // .market_plant.v1.IncrementalBatch batch = 4;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+
+  public:
+  void clear_batch() ;
+  const ::market_plant::v1::IncrementalBatch& batch() const;
+  [[nodiscard]] ::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE release_batch();
+  ::market_plant::v1::IncrementalBatch* PROTOBUF_NONNULL mutable_batch();
+  void set_allocated_batch(::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_batch(::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE value);
+  ::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE unsafe_arena_release_batch();
+
+  private:
+  const ::market_plant::v1::IncrementalBatch& _internal_batch() const;
+  ::market_plant::v1::IncrementalBatch* PROTOBUF_NONNULL _internal_mutable_batch();
+
+  public:
+  void clear_update_type();
+  UpdateTypeCase update_type_case() const;
+  // @@protoc_insertion_point(class_scope:market_plant.v1.OrderBookUpdate)
+ private:
+  class _Internal;
+  void set_has_snapshot();
+  void set_has_incremental();
+  void set_has_batch();
+  inline bool has_update_type() const;
+  inline void clear_has_update_type();
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 4,
+                                   3, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const OrderBookUpdate& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t instrument_id_;
+    union UpdateTypeUnion {
+      constexpr UpdateTypeUnion() : _constinit_{} {}
+      ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE snapshot_;
+      ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE incremental_;
+      ::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE batch_;
+    } update_type_;
+    ::uint32_t _oneof_case_[1];
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fplant_2fmarket_5fplant_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull OrderBookUpdate_class_data_;
+// -------------------------------------------------------------------
+
+class InstrumentSnapshot final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:market_plant.v1.InstrumentSnapshot) */ {
+ public:
+  inline InstrumentSnapshot() : InstrumentSnapshot(nullptr) {}
+  ~InstrumentSnapshot() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(InstrumentSnapshot* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(InstrumentSnapshot));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR InstrumentSnapshot(::google::protobuf::internal::ConstantInitialized);
+
+  inline InstrumentSnapshot(const InstrumentSnapshot& from) : InstrumentSnapshot(nullptr, from) {}
+  inline InstrumentSnapshot(InstrumentSnapshot&& from) noexcept
+      : InstrumentSnapshot(nullptr, ::std::move(from)) {}
+  inline InstrumentSnapshot& operator=(const InstrumentSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstrumentSnapshot& operator=(InstrumentSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstrumentSnapshot& default_instance() {
+    return *reinterpret_cast<const InstrumentSnapshot*>(
+        &_InstrumentSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 6;
+  friend void swap(InstrumentSnapshot& a, InstrumentSnapshot& b) { a.Swap(&b); }
+  inline void Swap(InstrumentSnapshot* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstrumentSnapshot* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstrumentSnapshot* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<InstrumentSnapshot>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const InstrumentSnapshot& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const InstrumentSnapshot& from) { InstrumentSnapshot::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(InstrumentSnapshot* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "market_plant.v1.InstrumentSnapshot"; }
+
+  explicit InstrumentSnapshot(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  InstrumentSnapshot(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const InstrumentSnapshot& from);
+  InstrumentSnapshot(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, InstrumentSnapshot&& from) noexcept
+      : InstrumentSnapshot(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kSnapshotFieldNumber = 3,
+    kVersionFieldNumber = 2,
+    kInstrumentIdFieldNumber = 1,
+  };
+  // .market_plant.v1.SnapshotUpdate snapshot = 3;
+  bool has_snapshot() const;
+  void clear_snapshot() ;
+  const ::market_plant::v1::SnapshotUpdate& snapshot() const;
+  [[nodiscard]] ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE release_snapshot();
+  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL mutable_snapshot();
+  void set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value);
+  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE unsafe_arena_release_snapshot();
+
+  private:
+  const ::market_plant::v1::SnapshotUpdate& _internal_snapshot() const;
+  ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL _internal_mutable_snapshot();
+
+  public:
+  // uint64 version = 2;
+  void clear_version() ;
+  ::uint64_t version() const;
+  void set_version(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_version() const;
+  void _internal_set_version(::uint64_t value);
+
+  public:
+  // uint32 instrument_id = 1;
+  void clear_instrument_id() ;
+  ::uint32_t instrument_id() const;
+  void set_instrument_id(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_instrument_id() const;
+  void _internal_set_instrument_id(::uint32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:market_plant.v1.InstrumentSnapshot)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const InstrumentSnapshot& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE snapshot_;
+    ::uint64_t version_;
+    ::uint32_t instrument_id_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fplant_2fmarket_5fplant_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull InstrumentSnapshot_class_data_;
+// -------------------------------------------------------------------
+
+class UpdateBatch final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:market_plant.v1.UpdateBatch) */ {
+ public:
+  inline UpdateBatch() : UpdateBatch(nullptr) {}
+  ~UpdateBatch() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(UpdateBatch* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(UpdateBatch));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR UpdateBatch(::google::protobuf::internal::ConstantInitialized);
+
+  inline UpdateBatch(const UpdateBatch& from) : UpdateBatch(nullptr, from) {}
+  inline UpdateBatch(UpdateBatch&& from) noexcept
+      : UpdateBatch(nullptr, ::std::move(from)) {}
+  inline UpdateBatch& operator=(const UpdateBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpdateBatch& operator=(UpdateBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateBatch& default_instance() {
+    return *reinterpret_cast<const UpdateBatch*>(
+        &_UpdateBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 12;
+  friend void swap(UpdateBatch& a, UpdateBatch& b) { a.Swap(&b); }
+  inline void Swap(UpdateBatch* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateBatch* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpdateBatch* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<UpdateBatch>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const UpdateBatch& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const UpdateBatch& from) { UpdateBatch::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(UpdateBatch* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "market_plant.v1.UpdateBatch"; }
+
+  explicit UpdateBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  UpdateBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const UpdateBatch& from);
+  UpdateBatch(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, UpdateBatch&& from) noexcept
+      : UpdateBatch(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kUpdatesFieldNumber = 2,
+  };
+  // repeated .market_plant.v1.OrderBookUpdate updates = 2;
+  int updates_size() const;
+  private:
+  int _internal_updates_size() const;
+
+  public:
+  void clear_updates() ;
+  ::market_plant::v1::OrderBookUpdate* PROTOBUF_NONNULL mutable_updates(int index);
+  ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>* PROTOBUF_NONNULL mutable_updates();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>& _internal_updates() const;
+  ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>* PROTOBUF_NONNULL _internal_mutable_updates();
+  public:
+  const ::market_plant::v1::OrderBookUpdate& updates(int index) const;
+  ::market_plant::v1::OrderBookUpdate* PROTOBUF_NONNULL add_updates();
+  const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>& updates() const;
+  // @@protoc_insertion_point(class_scope:market_plant.v1.UpdateBatch)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const UpdateBatch& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::market_plant::v1::OrderBookUpdate > updates_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fplant_2fmarket_5fplant_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull UpdateBatch_class_data_;
+// -------------------------------------------------------------------
+
+class SnapshotResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:market_plant.v1.SnapshotResponse) */ {
+ public:
+  inline SnapshotResponse() : SnapshotResponse(nullptr) {}
+  ~SnapshotResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(SnapshotResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(SnapshotResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR SnapshotResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline SnapshotResponse(const SnapshotResponse& from) : SnapshotResponse(nullptr, from) {}
+  inline SnapshotResponse(SnapshotResponse&& from) noexcept
+      : SnapshotResponse(nullptr, ::std::move(from)) {}
+  inline SnapshotResponse& operator=(const SnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SnapshotResponse& operator=(SnapshotResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotResponse& default_instance() {
+    return *reinterpret_cast<const SnapshotResponse*>(
+        &_SnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 7;
+  friend void swap(SnapshotResponse& a, SnapshotResponse& b) { a.Swap(&b); }
+  inline void Swap(SnapshotResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SnapshotResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SnapshotResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<SnapshotResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const SnapshotResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const SnapshotResponse& from) { SnapshotResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(SnapshotResponse* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "market_plant.v1.SnapshotResponse"; }
+
+  explicit SnapshotResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  SnapshotResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const SnapshotResponse& from);
+  SnapshotResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, SnapshotResponse&& from) noexcept
+      : SnapshotResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kSnapshotsFieldNumber = 1,
+  };
+  // repeated .market_plant.v1.InstrumentSnapshot snapshots = 1;
+  int snapshots_size() const;
+  private:
+  int _internal_snapshots_size() const;
+
+  public:
+  void clear_snapshots() ;
+  ::market_plant::v1::InstrumentSnapshot* PROTOBUF_NONNULL mutable_snapshots(int index);
+  ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>* PROTOBUF_NONNULL mutable_snapshots();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>& _internal_snapshots() const;
+  ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>* PROTOBUF_NONNULL _internal_mutable_snapshots();
+  public:
+  const ::market_plant::v1::InstrumentSnapshot& snapshots(int index) const;
+  ::market_plant::v1::InstrumentSnapshot* PROTOBUF_NONNULL add_snapshots();
+  const ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>& snapshots() const;
+  // @@protoc_insertion_point(class_scope:market_plant.v1.SnapshotResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   1, 0,
                                    2>
       _table_;
 
@@ -2120,24 +3225,17 @@ class OrderBookUpdate final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const OrderBookUpdate& from_msg);
+        const SnapshotResponse& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::uint32_t instrument_id_;
-    union UpdateTypeUnion {
-      constexpr UpdateTypeUnion() : _constinit_{} {}
-      ::google::protobuf::internal::ConstantInitialized _constinit_;
-      ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE snapshot_;
-      ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE incremental_;
-    } update_type_;
-    ::uint32_t _oneof_case_[1];
+    ::google::protobuf::RepeatedPtrField< ::market_plant::v1::InstrumentSnapshot > snapshots_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_market_5fplant_2fmarket_5fplant_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull OrderBookUpdate_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull SnapshotResponse_class_data_;
 // -------------------------------------------------------------------
 
 class StreamResponse final : public ::google::protobuf::Message
@@ -2198,9 +3296,10 @@ class StreamResponse final : public ::google::protobuf::Message
   enum PayloadCase {
     kInit = 1,
     kUpdate = 2,
+    kBatch = 3,
     PAYLOAD_NOT_SET = 0,
   };
-  static constexpr int kIndexInFileMessages = 8;
+  static constexpr int kIndexInFileMessages = 13;
   friend void swap(StreamResponse& a, StreamResponse& b) { a.Swap(&b); }
   inline void Swap(StreamResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -2289,6 +3388,7 @@ class StreamResponse final : public ::google::protobuf::Message
   enum : int {
     kInitFieldNumber = 1,
     kUpdateFieldNumber = 2,
+    kBatchFieldNumber = 3,
   };
   // .market_plant.v1.SubscriberInitialization init = 1;
   bool has_init() const;
@@ -2327,6 +3427,25 @@ class StreamResponse final : public ::google::protobuf::Message
   const ::market_plant::v1::OrderBookUpdate& _internal_update() const;
   ::market_plant::v1::OrderBookUpdate* PROTOBUF_NONNULL _internal_mutable_update();
 
+  public:
+  // .market_plant.v1.UpdateBatch batch = 3;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+
+  public:
+  void clear_batch() ;
+  const ::market_plant::v1::UpdateBatch& batch() const;
+  [[nodiscard]] ::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE release_batch();
+  ::market_plant::v1::UpdateBatch* PROTOBUF_NONNULL mutable_batch();
+  void set_allocated_batch(::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_batch(::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE value);
+  ::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE unsafe_arena_release_batch();
+
+  private:
+  const ::market_plant::v1::UpdateBatch& _internal_batch() const;
+  ::market_plant::v1::UpdateBatch* PROTOBUF_NONNULL _internal_mutable_batch();
+
   public:
   void clear_payload();
   PayloadCase payload_case() const;
@@ -2335,11 +3454,12 @@ class StreamResponse final : public ::google::protobuf::Message
   class _Internal;
   void set_has_init();
   void set_has_update();
+  void set_has_batch();
   inline bool has_payload() const;
   inline void clear_has_payload();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 2,
-                                   2, 0,
+  static const ::google::protobuf::internal::TcParseTable<0, 3,
+                                   3, 0,
                                    2>
       _table_;
 
@@ -2363,6 +3483,7 @@ class StreamResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::ConstantInitialized _constinit_;
       ::market_plant::v1::SubscriberInitialization* PROTOBUF_NULLABLE init_;
       ::market_plant::v1::OrderBookUpdate* PROTOBUF_NULLABLE update_;
+      ::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE batch_;
     } payload_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::uint32_t _oneof_case_[1];
@@ -2814,6 +3935,91 @@ inline void IncrementalUpdate::set_allocated_update(::market_plant::v1::OrderBoo
 
 // -------------------------------------------------------------------
 
+// IncrementalBatch
+
+// repeated .market_plant.v1.OrderBookEventUpdate updates = 1;
+inline int IncrementalBatch::_internal_updates_size() const {
+  return _internal_updates().size();
+}
+inline int IncrementalBatch::updates_size() const {
+  return _internal_updates_size();
+}
+inline void IncrementalBatch::clear_updates() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.updates_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::market_plant::v1::OrderBookEventUpdate* PROTOBUF_NONNULL IncrementalBatch::mutable_updates(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.IncrementalBatch.updates)
+  return _internal_mutable_updates()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>* PROTOBUF_NONNULL IncrementalBatch::mutable_updates()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:market_plant.v1.IncrementalBatch.updates)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_updates();
+}
+inline const ::market_plant::v1::OrderBookEventUpdate& IncrementalBatch::updates(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.IncrementalBatch.updates)
+  return _internal_updates().Get(index);
+}
+inline ::market_plant::v1::OrderBookEventUpdate* PROTOBUF_NONNULL IncrementalBatch::add_updates()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::market_plant::v1::OrderBookEventUpdate* _add =
+      _internal_mutable_updates()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:market_plant.v1.IncrementalBatch.updates)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>& IncrementalBatch::updates() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:market_plant.v1.IncrementalBatch.updates)
+  return _internal_updates();
+}
+inline const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>&
+IncrementalBatch::_internal_updates() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.updates_;
+}
+inline ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookEventUpdate>* PROTOBUF_NONNULL
+IncrementalBatch::_internal_mutable_updates() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.updates_;
+}
+
+// uint32 conflated = 2;
+inline void IncrementalBatch::clear_conflated() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.conflated_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline ::uint32_t IncrementalBatch::conflated() const {
+  // @@protoc_insertion_point(field_get:market_plant.v1.IncrementalBatch.conflated)
+  return _internal_conflated();
+}
+inline void IncrementalBatch::set_conflated(::uint32_t value) {
+  _internal_set_conflated(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:market_plant.v1.IncrementalBatch.conflated)
+}
+inline ::uint32_t IncrementalBatch::_internal_conflated() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.conflated_;
+}
+inline void IncrementalBatch::_internal_set_conflated(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.conflated_ = value;
+}
+
+// -------------------------------------------------------------------
+
 // OrderBookUpdate
 
 // uint32 instrument_id = 1;
@@ -2952,68 +4158,363 @@ inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE OrderBookUpdate:
     if (GetArena() != nullptr) {
       temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.update_type_.incremental_ = nullptr;
-    return temp;
+    _impl_.update_type_.incremental_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::market_plant::v1::IncrementalUpdate& OrderBookUpdate::_internal_incremental() const {
+  return update_type_case() == kIncremental ? static_cast<const ::market_plant::v1::IncrementalUpdate&>(*_impl_.update_type_.incremental_)
+                     : reinterpret_cast<const ::market_plant::v1::IncrementalUpdate&>(::market_plant::v1::_IncrementalUpdate_default_instance_);
+}
+inline const ::market_plant::v1::IncrementalUpdate& OrderBookUpdate::incremental() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.OrderBookUpdate.incremental)
+  return _internal_incremental();
+}
+inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE OrderBookUpdate::unsafe_arena_release_incremental() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:market_plant.v1.OrderBookUpdate.incremental)
+  if (update_type_case() == kIncremental) {
+    clear_has_update_type();
+    auto* temp = _impl_.update_type_.incremental_;
+    _impl_.update_type_.incremental_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OrderBookUpdate::unsafe_arena_set_allocated_incremental(
+    ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_update_type();
+  if (value) {
+    set_has_incremental();
+    _impl_.update_type_.incremental_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:market_plant.v1.OrderBookUpdate.incremental)
+}
+inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL OrderBookUpdate::_internal_mutable_incremental() {
+  if (update_type_case() != kIncremental) {
+    clear_update_type();
+    set_has_incremental();
+    _impl_.update_type_.incremental_ = 
+        ::google::protobuf::Message::DefaultConstruct<::market_plant::v1::IncrementalUpdate>(GetArena());
+  }
+  return _impl_.update_type_.incremental_;
+}
+inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL OrderBookUpdate::mutable_incremental()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::market_plant::v1::IncrementalUpdate* _msg = _internal_mutable_incremental();
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.OrderBookUpdate.incremental)
+  return _msg;
+}
+
+// .market_plant.v1.IncrementalBatch batch = 4;
+inline bool OrderBookUpdate::has_batch() const {
+  return update_type_case() == kBatch;
+}
+inline bool OrderBookUpdate::_internal_has_batch() const {
+  return update_type_case() == kBatch;
+}
+inline void OrderBookUpdate::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
+}
+inline void OrderBookUpdate::clear_batch() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (update_type_case() == kBatch) {
+    if (GetArena() == nullptr) {
+      delete _impl_.update_type_.batch_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.batch_);
+    }
+    clear_has_update_type();
+  }
+}
+inline ::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE OrderBookUpdate::release_batch() {
+  // @@protoc_insertion_point(field_release:market_plant.v1.OrderBookUpdate.batch)
+  if (update_type_case() == kBatch) {
+    clear_has_update_type();
+    auto* temp = _impl_.update_type_.batch_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.update_type_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::market_plant::v1::IncrementalBatch& OrderBookUpdate::_internal_batch() const {
+  return update_type_case() == kBatch ? static_cast<const ::market_plant::v1::IncrementalBatch&>(*_impl_.update_type_.batch_)
+                     : reinterpret_cast<const ::market_plant::v1::IncrementalBatch&>(::market_plant::v1::_IncrementalBatch_default_instance_);
+}
+inline const ::market_plant::v1::IncrementalBatch& OrderBookUpdate::batch() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.OrderBookUpdate.batch)
+  return _internal_batch();
+}
+inline ::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE OrderBookUpdate::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:market_plant.v1.OrderBookUpdate.batch)
+  if (update_type_case() == kBatch) {
+    clear_has_update_type();
+    auto* temp = _impl_.update_type_.batch_;
+    _impl_.update_type_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void OrderBookUpdate::unsafe_arena_set_allocated_batch(
+    ::market_plant::v1::IncrementalBatch* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_update_type();
+  if (value) {
+    set_has_batch();
+    _impl_.update_type_.batch_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:market_plant.v1.OrderBookUpdate.batch)
+}
+inline ::market_plant::v1::IncrementalBatch* PROTOBUF_NONNULL OrderBookUpdate::_internal_mutable_batch() {
+  if (update_type_case() != kBatch) {
+    clear_update_type();
+    set_has_batch();
+    _impl_.update_type_.batch_ = 
+        ::google::protobuf::Message::DefaultConstruct<::market_plant::v1::IncrementalBatch>(GetArena());
+  }
+  return _impl_.update_type_.batch_;
+}
+inline ::market_plant::v1::IncrementalBatch* PROTOBUF_NONNULL OrderBookUpdate::mutable_batch()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::market_plant::v1::IncrementalBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.OrderBookUpdate.batch)
+  return _msg;
+}
+
+inline bool OrderBookUpdate::has_update_type() const {
+  return update_type_case() != UPDATE_TYPE_NOT_SET;
+}
+inline void OrderBookUpdate::clear_has_update_type() {
+  _impl_._oneof_case_[0] = UPDATE_TYPE_NOT_SET;
+}
+inline OrderBookUpdate::UpdateTypeCase OrderBookUpdate::update_type_case() const {
+  return OrderBookUpdate::UpdateTypeCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// InstrumentSnapshot
+
+// uint32 instrument_id = 1;
+inline void InstrumentSnapshot::clear_instrument_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.instrument_id_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline ::uint32_t InstrumentSnapshot::instrument_id() const {
+  // @@protoc_insertion_point(field_get:market_plant.v1.InstrumentSnapshot.instrument_id)
+  return _internal_instrument_id();
+}
+inline void InstrumentSnapshot::set_instrument_id(::uint32_t value) {
+  _internal_set_instrument_id(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:market_plant.v1.InstrumentSnapshot.instrument_id)
+}
+inline ::uint32_t InstrumentSnapshot::_internal_instrument_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.instrument_id_;
+}
+inline void InstrumentSnapshot::_internal_set_instrument_id(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.instrument_id_ = value;
+}
+
+// uint64 version = 2;
+inline void InstrumentSnapshot::clear_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.version_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline ::uint64_t InstrumentSnapshot::version() const {
+  // @@protoc_insertion_point(field_get:market_plant.v1.InstrumentSnapshot.version)
+  return _internal_version();
+}
+inline void InstrumentSnapshot::set_version(::uint64_t value) {
+  _internal_set_version(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:market_plant.v1.InstrumentSnapshot.version)
+}
+inline ::uint64_t InstrumentSnapshot::_internal_version() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.version_;
+}
+inline void InstrumentSnapshot::_internal_set_version(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.version_ = value;
+}
+
+// .market_plant.v1.SnapshotUpdate snapshot = 3;
+inline bool InstrumentSnapshot::has_snapshot() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000001U);
+  PROTOBUF_ASSUME(!value || _impl_.snapshot_ != nullptr);
+  return value;
+}
+inline void InstrumentSnapshot::clear_snapshot() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.snapshot_ != nullptr) _impl_.snapshot_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::market_plant::v1::SnapshotUpdate& InstrumentSnapshot::_internal_snapshot() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::market_plant::v1::SnapshotUpdate* p = _impl_.snapshot_;
+  return p != nullptr ? *p : reinterpret_cast<const ::market_plant::v1::SnapshotUpdate&>(::market_plant::v1::_SnapshotUpdate_default_instance_);
+}
+inline const ::market_plant::v1::SnapshotUpdate& InstrumentSnapshot::snapshot() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.InstrumentSnapshot.snapshot)
+  return _internal_snapshot();
+}
+inline void InstrumentSnapshot::unsafe_arena_set_allocated_snapshot(
+    ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.snapshot_);
+  }
+  _impl_.snapshot_ = reinterpret_cast<::market_plant::v1::SnapshotUpdate*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:market_plant.v1.InstrumentSnapshot.snapshot)
+}
+inline ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE InstrumentSnapshot::release_snapshot() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::market_plant::v1::SnapshotUpdate* released = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE InstrumentSnapshot::unsafe_arena_release_snapshot() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:market_plant.v1.InstrumentSnapshot.snapshot)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::market_plant::v1::SnapshotUpdate* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+  return temp;
+}
+inline ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL InstrumentSnapshot::_internal_mutable_snapshot() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.snapshot_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::market_plant::v1::SnapshotUpdate>(GetArena());
+    _impl_.snapshot_ = reinterpret_cast<::market_plant::v1::SnapshotUpdate*>(p);
+  }
+  return _impl_.snapshot_;
+}
+inline ::market_plant::v1::SnapshotUpdate* PROTOBUF_NONNULL InstrumentSnapshot::mutable_snapshot()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::market_plant::v1::SnapshotUpdate* _msg = _internal_mutable_snapshot();
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.InstrumentSnapshot.snapshot)
+  return _msg;
+}
+inline void InstrumentSnapshot::set_allocated_snapshot(::market_plant::v1::SnapshotUpdate* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.snapshot_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
   } else {
-    return nullptr;
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
   }
+
+  _impl_.snapshot_ = reinterpret_cast<::market_plant::v1::SnapshotUpdate*>(value);
+  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.InstrumentSnapshot.snapshot)
 }
-inline const ::market_plant::v1::IncrementalUpdate& OrderBookUpdate::_internal_incremental() const {
-  return update_type_case() == kIncremental ? static_cast<const ::market_plant::v1::IncrementalUpdate&>(*_impl_.update_type_.incremental_)
-                     : reinterpret_cast<const ::market_plant::v1::IncrementalUpdate&>(::market_plant::v1::_IncrementalUpdate_default_instance_);
+
+// -------------------------------------------------------------------
+
+// SnapshotResponse
+
+// repeated .market_plant.v1.InstrumentSnapshot snapshots = 1;
+inline int SnapshotResponse::_internal_snapshots_size() const {
+  return _internal_snapshots().size();
 }
-inline const ::market_plant::v1::IncrementalUpdate& OrderBookUpdate::incremental() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:market_plant.v1.OrderBookUpdate.incremental)
-  return _internal_incremental();
+inline int SnapshotResponse::snapshots_size() const {
+  return _internal_snapshots_size();
 }
-inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE OrderBookUpdate::unsafe_arena_release_incremental() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:market_plant.v1.OrderBookUpdate.incremental)
-  if (update_type_case() == kIncremental) {
-    clear_has_update_type();
-    auto* temp = _impl_.update_type_.incremental_;
-    _impl_.update_type_.incremental_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SnapshotResponse::clear_snapshots() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.snapshots_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
 }
-inline void OrderBookUpdate::unsafe_arena_set_allocated_incremental(
-    ::market_plant::v1::IncrementalUpdate* PROTOBUF_NULLABLE value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_update_type();
-  if (value) {
-    set_has_incremental();
-    _impl_.update_type_.incremental_ = value;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:market_plant.v1.OrderBookUpdate.incremental)
+inline ::market_plant::v1::InstrumentSnapshot* PROTOBUF_NONNULL SnapshotResponse::mutable_snapshots(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.SnapshotResponse.snapshots)
+  return _internal_mutable_snapshots()->Mutable(index);
 }
-inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL OrderBookUpdate::_internal_mutable_incremental() {
-  if (update_type_case() != kIncremental) {
-    clear_update_type();
-    set_has_incremental();
-    _impl_.update_type_.incremental_ = 
-        ::google::protobuf::Message::DefaultConstruct<::market_plant::v1::IncrementalUpdate>(GetArena());
-  }
-  return _impl_.update_type_.incremental_;
+inline ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>* PROTOBUF_NONNULL SnapshotResponse::mutable_snapshots()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:market_plant.v1.SnapshotResponse.snapshots)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_snapshots();
 }
-inline ::market_plant::v1::IncrementalUpdate* PROTOBUF_NONNULL OrderBookUpdate::mutable_incremental()
+inline const ::market_plant::v1::InstrumentSnapshot& SnapshotResponse::snapshots(int index) const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::market_plant::v1::IncrementalUpdate* _msg = _internal_mutable_incremental();
-  // @@protoc_insertion_point(field_mutable:market_plant.v1.OrderBookUpdate.incremental)
-  return _msg;
+  // @@protoc_insertion_point(field_get:market_plant.v1.SnapshotResponse.snapshots)
+  return _internal_snapshots().Get(index);
 }
-
-inline bool OrderBookUpdate::has_update_type() const {
-  return update_type_case() != UPDATE_TYPE_NOT_SET;
+inline ::market_plant::v1::InstrumentSnapshot* PROTOBUF_NONNULL SnapshotResponse::add_snapshots()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::market_plant::v1::InstrumentSnapshot* _add =
+      _internal_mutable_snapshots()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:market_plant.v1.SnapshotResponse.snapshots)
+  return _add;
 }
-inline void OrderBookUpdate::clear_has_update_type() {
-  _impl_._oneof_case_[0] = UPDATE_TYPE_NOT_SET;
+inline const ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>& SnapshotResponse::snapshots() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:market_plant.v1.SnapshotResponse.snapshots)
+  return _internal_snapshots();
 }
-inline OrderBookUpdate::UpdateTypeCase OrderBookUpdate::update_type_case() const {
-  return OrderBookUpdate::UpdateTypeCase(_impl_._oneof_case_[0]);
+inline const ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>&
+SnapshotResponse::_internal_snapshots() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.snapshots_;
+}
+inline ::google::protobuf::RepeatedPtrField<::market_plant::v1::InstrumentSnapshot>* PROTOBUF_NONNULL
+SnapshotResponse::_internal_mutable_snapshots() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.snapshots_;
 }
+
 // -------------------------------------------------------------------
 
 // InstrumentIds
@@ -3070,6 +4571,85 @@ InstrumentIds::_internal_mutable_ids() {
 
 // -------------------------------------------------------------------
 
+// SubscriptionOptions
+
+// bool absolute_quantity = 1;
+inline void SubscriptionOptions::clear_absolute_quantity() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.absolute_quantity_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline bool SubscriptionOptions::absolute_quantity() const {
+  // @@protoc_insertion_point(field_get:market_plant.v1.SubscriptionOptions.absolute_quantity)
+  return _internal_absolute_quantity();
+}
+inline void SubscriptionOptions::set_absolute_quantity(bool value) {
+  _internal_set_absolute_quantity(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_set:market_plant.v1.SubscriptionOptions.absolute_quantity)
+}
+inline bool SubscriptionOptions::_internal_absolute_quantity() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.absolute_quantity_;
+}
+inline void SubscriptionOptions::_internal_set_absolute_quantity(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.absolute_quantity_ = value;
+}
+
+// bool batch_updates = 2;
+inline void SubscriptionOptions::clear_batch_updates() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.batch_updates_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline bool SubscriptionOptions::batch_updates() const {
+  // @@protoc_insertion_point(field_get:market_plant.v1.SubscriptionOptions.batch_updates)
+  return _internal_batch_updates();
+}
+inline void SubscriptionOptions::set_batch_updates(bool value) {
+  _internal_set_batch_updates(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:market_plant.v1.SubscriptionOptions.batch_updates)
+}
+inline bool SubscriptionOptions::_internal_batch_updates() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.batch_updates_;
+}
+inline void SubscriptionOptions::_internal_set_batch_updates(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.batch_updates_ = value;
+}
+
+// uint32 conflate_backlog = 3;
+inline void SubscriptionOptions::clear_conflate_backlog() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.conflate_backlog_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline ::uint32_t SubscriptionOptions::conflate_backlog() const {
+  // @@protoc_insertion_point(field_get:market_plant.v1.SubscriptionOptions.conflate_backlog)
+  return _internal_conflate_backlog();
+}
+inline void SubscriptionOptions::set_conflate_backlog(::uint32_t value) {
+  _internal_set_conflate_backlog(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:market_plant.v1.SubscriptionOptions.conflate_backlog)
+}
+inline ::uint32_t SubscriptionOptions::_internal_conflate_backlog() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.conflate_backlog_;
+}
+inline void SubscriptionOptions::_internal_set_conflate_backlog(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.conflate_backlog_ = value;
+}
+
+// -------------------------------------------------------------------
+
 // Subscription
 
 // .market_plant.v1.InstrumentIds subscribe = 1;
@@ -3236,6 +4816,105 @@ inline ::market_plant::v1::InstrumentIds* PROTOBUF_NONNULL Subscription::mutable
   return _msg;
 }
 
+// .market_plant.v1.SubscriptionOptions options = 3;
+inline bool Subscription::has_options() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000001U);
+  PROTOBUF_ASSUME(!value || _impl_.options_ != nullptr);
+  return value;
+}
+inline void Subscription::clear_options() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.options_ != nullptr) _impl_.options_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::market_plant::v1::SubscriptionOptions& Subscription::_internal_options() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::market_plant::v1::SubscriptionOptions* p = _impl_.options_;
+  return p != nullptr ? *p : reinterpret_cast<const ::market_plant::v1::SubscriptionOptions&>(::market_plant::v1::_SubscriptionOptions_default_instance_);
+}
+inline const ::market_plant::v1::SubscriptionOptions& Subscription::options() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.Subscription.options)
+  return _internal_options();
+}
+inline void Subscription::unsafe_arena_set_allocated_options(
+    ::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.options_);
+  }
+  _impl_.options_ = reinterpret_cast<::market_plant::v1::SubscriptionOptions*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:market_plant.v1.Subscription.options)
+}
+inline ::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE Subscription::release_options() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::market_plant::v1::SubscriptionOptions* released = _impl_.options_;
+  _impl_.options_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE Subscription::unsafe_arena_release_options() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:market_plant.v1.Subscription.options)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::market_plant::v1::SubscriptionOptions* temp = _impl_.options_;
+  _impl_.options_ = nullptr;
+  return temp;
+}
+inline ::market_plant::v1::SubscriptionOptions* PROTOBUF_NONNULL Subscription::_internal_mutable_options() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.options_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::market_plant::v1::SubscriptionOptions>(GetArena());
+    _impl_.options_ = reinterpret_cast<::market_plant::v1::SubscriptionOptions*>(p);
+  }
+  return _impl_.options_;
+}
+inline ::market_plant::v1::SubscriptionOptions* PROTOBUF_NONNULL Subscription::mutable_options()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::market_plant::v1::SubscriptionOptions* _msg = _internal_mutable_options();
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.Subscription.options)
+  return _msg;
+}
+inline void Subscription::set_allocated_options(::market_plant::v1::SubscriptionOptions* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.options_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+
+  _impl_.options_ = reinterpret_cast<::market_plant::v1::SubscriptionOptions*>(value);
+  // @@protoc_insertion_point(field_set_allocated:market_plant.v1.Subscription.options)
+}
+
 inline bool Subscription::has_action() const {
   return action_case() != ACTION_NOT_SET;
 }
@@ -3341,6 +5020,66 @@ inline void SubscriberInitialization::set_allocated_session_id(::std::string* PR
 
 // -------------------------------------------------------------------
 
+// UpdateBatch
+
+// repeated .market_plant.v1.OrderBookUpdate updates = 2;
+inline int UpdateBatch::_internal_updates_size() const {
+  return _internal_updates().size();
+}
+inline int UpdateBatch::updates_size() const {
+  return _internal_updates_size();
+}
+inline void UpdateBatch::clear_updates() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.updates_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::market_plant::v1::OrderBookUpdate* PROTOBUF_NONNULL UpdateBatch::mutable_updates(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.UpdateBatch.updates)
+  return _internal_mutable_updates()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>* PROTOBUF_NONNULL UpdateBatch::mutable_updates()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:market_plant.v1.UpdateBatch.updates)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_updates();
+}
+inline const ::market_plant::v1::OrderBookUpdate& UpdateBatch::updates(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.UpdateBatch.updates)
+  return _internal_updates().Get(index);
+}
+inline ::market_plant::v1::OrderBookUpdate* PROTOBUF_NONNULL UpdateBatch::add_updates()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::market_plant::v1::OrderBookUpdate* _add =
+      _internal_mutable_updates()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:market_plant.v1.UpdateBatch.updates)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>& UpdateBatch::updates() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:market_plant.v1.UpdateBatch.updates)
+  return _internal_updates();
+}
+inline const ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>&
+UpdateBatch::_internal_updates() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.updates_;
+}
+inline ::google::protobuf::RepeatedPtrField<::market_plant::v1::OrderBookUpdate>* PROTOBUF_NONNULL
+UpdateBatch::_internal_mutable_updates() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.updates_;
+}
+
+// -------------------------------------------------------------------
+
 // StreamResponse
 
 // .market_plant.v1.SubscriberInitialization init = 1;
@@ -3507,6 +5246,88 @@ inline ::market_plant::v1::OrderBookUpdate* PROTOBUF_NONNULL StreamResponse::mut
   return _msg;
 }
 
+// .market_plant.v1.UpdateBatch batch = 3;
+inline bool StreamResponse::has_batch() const {
+  return payload_case() == kBatch;
+}
+inline bool StreamResponse::_internal_has_batch() const {
+  return payload_case() == kBatch;
+}
+inline void StreamResponse::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
+}
+inline void StreamResponse::clear_batch() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (payload_case() == kBatch) {
+    if (GetArena() == nullptr) {
+      delete _impl_.payload_.batch_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.batch_);
+    }
+    clear_has_payload();
+  }
+}
+inline ::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE StreamResponse::release_batch() {
+  // @@protoc_insertion_point(field_release:market_plant.v1.StreamResponse.batch)
+  if (payload_case() == kBatch) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.batch_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::market_plant::v1::UpdateBatch& StreamResponse::_internal_batch() const {
+  return payload_case() == kBatch ? static_cast<const ::market_plant::v1::UpdateBatch&>(*_impl_.payload_.batch_)
+                     : reinterpret_cast<const ::market_plant::v1::UpdateBatch&>(::market_plant::v1::_UpdateBatch_default_instance_);
+}
+inline const ::market_plant::v1::UpdateBatch& StreamResponse::batch() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:market_plant.v1.StreamResponse.batch)
+  return _internal_batch();
+}
+inline ::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE StreamResponse::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:market_plant.v1.StreamResponse.batch)
+  if (payload_case() == kBatch) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.batch_;
+    _impl_.payload_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void StreamResponse::unsafe_arena_set_allocated_batch(
+    ::market_plant::v1::UpdateBatch* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_payload();
+  if (value) {
+    set_has_batch();
+    _impl_.payload_.batch_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:market_plant.v1.StreamResponse.batch)
+}
+inline ::market_plant::v1::UpdateBatch* PROTOBUF_NONNULL StreamResponse::_internal_mutable_batch() {
+  if (payload_case() != kBatch) {
+    clear_payload();
+    set_has_batch();
+    _impl_.payload_.batch_ = 
+        ::google::protobuf::Message::DefaultConstruct<::market_plant::v1::UpdateBatch>(GetArena());
+  }
+  return _impl_.payload_.batch_;
+}
+inline ::market_plant::v1::UpdateBatch* PROTOBUF_NONNULL StreamResponse::mutable_batch()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::market_plant::v1::UpdateBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:market_plant.v1.StreamResponse.batch)
+  return _msg;
+}
+
 inline bool StreamResponse::has_payload() const {
   return payload_case() != PAYLOAD_NOT_SET;
 }
@@ -0,0 +1,171 @@
+#include "capture.h"
+
+#include "endian.h"
+
+#include <cstring>
+#include <stdexcept>
+
+static constexpr std::uint32_t kPcapMagicMicros = 0xa1b2c3d4;
+static constexpr std::uint32_t kPcapMagicNanos = 0xa1b23c4d;
+static constexpr Bytes kPcapHeaderLength = 24;
+static constexpr Bytes kPcapRecordLength = 16;
+
+// Link types
+static constexpr std::uint32_t kLinkNull = 0;
+static constexpr std::uint32_t kLinkEthernet = 1;
+static constexpr std::uint32_t kLinkRaw = 101;
+static constexpr std::uint32_t kLinkLinuxSll = 113;
+static constexpr std::uint32_t kLinkIpv4 = 228;
+
+static constexpr std::uint16_t kEtherTypeIpv4 = 0x0800;
+static constexpr std::uint16_t kEtherTypeVlan = 0x8100;
+static constexpr std::uint8_t kProtocolUdp = 17;
+static constexpr Bytes kUdpHeaderLength = 8;
+
+static constexpr Bytes kRecordHeaderLength = sizeof(Timestamp) + sizeof(std::uint16_t);
+
+CaptureReader::CaptureReader(const std::string& path, std::uint16_t port)
+    : in_(path, std::ios::binary), port_(port) {
+
+    if (!in_.is_open()) throw std::runtime_error("Error: unable to open capture " + path);
+
+    std::uint8_t header[kPcapHeaderLength];
+    if (!in_.read(reinterpret_cast<char*>(header), sizeof(kCaptureMagic))) {
+        throw std::runtime_error("Error: capture " + path + " is empty.");
+    }
+
+    if (std::memcmp(header, kCaptureMagic, sizeof(kCaptureMagic)) == 0) {
+        format_ = Format::kRecorded;
+        start_ = in_.tellg();
+        return;
+    }
+
+    if (!in_.read(reinterpret_cast<char*>(header) + sizeof(kCaptureMagic), kPcapHeaderLength - sizeof(kCaptureMagic))) {
+        throw std::runtime_error("Error: unrecognized capture format in " + path);
+    }
+
+    const std::uint32_t magic = ReadLittleEndian<std::uint32_t>(header, 0);
+    const std::uint32_t swapped_magic = ReadBigEndian<std::uint32_t>(header, 0);
+
+    if (magic == kPcapMagicMicros || magic == kPcapMagicNanos) {
+        nanosecond_ = magic == kPcapMagicNanos;
+    } else if (swapped_magic == kPcapMagicMicros || swapped_magic == kPcapMagicNanos) {
+        swapped_ = true;
+        nanosecond_ = swapped_magic == kPcapMagicNanos;
+    } else {
+        throw std::runtime_error("Error: unrecognized capture format in " + path + " (pcapng is not supported).");
+    }
+
+    format_ = Format::kPcap;
+    link_type_ = ReadPcap32(header, 20) & 0xFFFF;
+    start_ = in_.tellg();
+}
+
+bool CaptureReader::Next(CapturedPacket& packet) {
+    return format_ == Format::kRecorded ? NextRecorded(packet) : NextPcap(packet);
+}
+
+void CaptureReader::Rewind() {
+    in_.clear();
+    in_.seekg(start_);
+}
+
+bool CaptureReader::NextRecorded(CapturedPacket& packet) {
+    std::uint8_t header[kRecordHeaderLength];
+    if (!in_.read(reinterpret_cast<char*>(header), kRecordHeaderLength)) return false;
+
+    packet.timestamp = ReadBigEndian<Timestamp>(header, 0);
+    const std::uint16_t len = ReadBigEndian<std::uint16_t>(header, sizeof(Timestamp));
+
+    packet.data.resize(len);
+    return static_cast<bool>(in_.read(reinterpret_cast<char*>(packet.data.data()), len));
+}
+
+bool CaptureReader::NextPcap(CapturedPacket& packet) {
+    // Skip frames that do not carry a matching IPv4/UDP datagram
+    while (true) {
+        std::uint8_t header[kPcapRecordLength];
+        if (!in_.read(reinterpret_cast<char*>(header), kPcapRecordLength)) return false;
+
+        const std::uint32_t seconds = ReadPcap32(header, 0);
+        const std::uint32_t fraction = ReadPcap32(header, 4);
+        const std::uint32_t captured = ReadPcap32(header, 8);
+
+        frame_.resize(captured);
+        if (!in_.read(reinterpret_cast<char*>(frame_.data()), captured)) return false;
+
+        packet.timestamp = static_cast<Timestamp>(seconds) * 1000000000ULL +
+                           static_cast<Timestamp>(fraction) * (nanosecond_ ? 1ULL : 1000ULL);
+
+        if (ExtractUdpPayload(frame_.data(), captured, packet)) return true;
+    }
+}
+
+bool CaptureReader::ExtractUdpPayload(const std::uint8_t* frame, Bytes len, CapturedPacket& packet) const {
+    Bytes offset = 0;
+
+    switch (link_type_) {
+        case kLinkEthernet: {
+            if (len < 14) return false;
+            std::uint16_t ether_type = ReadBigEndian<std::uint16_t>(frame, 12);
+            offset = 14;
+            if (ether_type == kEtherTypeVlan) {
+                if (len < 18) return false;
+                ether_type = ReadBigEndian<std::uint16_t>(frame, 16);
+                offset = 18;
+            }
+            if (ether_type != kEtherTypeIpv4) return false;
+            break;
+        }
+        case kLinkLinuxSll:
+            if (len < 16 || ReadBigEndian<std::uint16_t>(frame, 14) != kEtherTypeIpv4) return false;
+            offset = 16;
+            break;
+        case kLinkNull:
+            offset = 4;
+            break;
+        case kLinkRaw:
+        case kLinkIpv4:
+            offset = 0;
+            break;
+        default:
+            return false;
+    }
+
+    // IPv4; a header length below the 20-byte minimum or past the captured bytes marks a corrupt frame
+    if (len < offset + 20 || (frame[offset] >> 4) != 4) return false;
+    const Bytes ip_header_length = static_cast<Bytes>(frame[offset] & 0x0F) * 4;
+    if (ip_header_length < 20 || len < offset + ip_header_length) return false;
+    const std::uint16_t fragment = ReadBigEndian<std::uint16_t>(frame, offset + 6);
+    if (frame[offset + 9] != kProtocolUdp || (fragment & 0x3FFF) != 0) return false;
+    offset += ip_header_length;
+
+    // UDP
+    if (len < offset + kUdpHeaderLength) return false;
+    const std::uint16_t dst_port = ReadBigEndian<std::uint16_t>(frame, offset + 2);
+    const Bytes udp_length = ReadBigEndian<std::uint16_t>(frame, offset + 4);
+    if (port_ != 0 && dst_port != port_) return false;
+    if (udp_length < kUdpHeaderLength || len < offset + udp_length) return false;
+
+    packet.data.assign(frame + offset + kUdpHeaderLength, frame + offset + udp_length);
+    return true;
+}
+
+std::uint32_t CaptureReader::ReadPcap32(const std::uint8_t* buf, Bytes offset) const {
+    return swapped_ ? ReadBigEndian<std::uint32_t>(buf, offset) : ReadLittleEndian<std::uint32_t>(buf, offset);
+}
+
+CaptureWriter::CaptureWriter(const std::string& path) : out_(path, std::ios::binary | std::ios::trunc) {
+    if (!out_.is_open()) throw std::runtime_error("Error: unable to open capture " + path);
+    out_.write(kCaptureMagic, sizeof(kCaptureMagic));
+}
+
+void CaptureWriter::Write(Timestamp timestamp, const std::uint8_t* packet, Bytes len) {
+    std::uint8_t header[kRecordHeaderLength];
+    WriteBigEndian<Timestamp>(header, 0, timestamp);
+    WriteBigEndian<std::uint16_t>(header, sizeof(Timestamp), static_cast<std::uint16_t>(len));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    out_.write(reinterpret_cast<const char*>(header), kRecordHeaderLength);
+    out_.write(reinterpret_cast<const char*>(packet), static_cast<std::streamsize>(len));
+}
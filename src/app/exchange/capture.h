@@ -0,0 +1,77 @@
+#pragma once
+
+#include "event.h"
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+
+Recorded Capture Format (Network-Byte-Order / Big Endian)
+
+header:     magic           (8 bytes)             "MOLDCAP1"
+record:     capture_ts      (8 bytes, u64)        ns
+            length          (2 bytes, u16)        bytes of the MoldUDP64 packet that follows
+            packet          ('length' bytes)      MoldUDP64 header + message blocks
+
+*/
+
+inline constexpr char kCaptureMagic[8] = {'M','O','L','D','C','A','P','1'};
+
+struct CapturedPacket {
+    Timestamp timestamp = 0;            // ns
+    std::vector<std::uint8_t> data;     // MoldUDP64 packet (UDP payload)
+};
+
+/*
+Reads MoldUDP64 packets from a recorded capture or a classic libpcap file
+(Ethernet, Linux cooked, raw IPv4 or BSD loopback; IPv4/UDP only).
+*/
+class CaptureReader {
+public:
+    // 'port' filters pcap datagrams by UDP destination port (0 = any)
+    CaptureReader(const std::string& path, std::uint16_t port = 0);
+
+    // Returns false at the end of the capture
+    bool Next(CapturedPacket& packet);
+
+    void Rewind();
+
+private:
+    enum class Format { kRecorded, kPcap };
+
+    bool NextRecorded(CapturedPacket& packet);
+
+    bool NextPcap(CapturedPacket& packet);
+
+    // Locates the UDP payload inside a link-layer frame; false if the frame is not IPv4/UDP
+    bool ExtractUdpPayload(const std::uint8_t* frame, Bytes len, CapturedPacket& packet) const;
+
+    std::uint32_t ReadPcap32(const std::uint8_t* buf, Bytes offset) const;
+
+    std::ifstream in_;
+    std::streampos start_;
+    Format format_;
+    std::uint16_t port_;
+
+    // pcap only
+    bool swapped_ = false;          // file written in big-endian host order
+    bool nanosecond_ = false;
+    std::uint32_t link_type_ = 0;
+    std::vector<std::uint8_t> frame_;
+};
+
+// Appends published packets to a recorded capture (thread-safe)
+class CaptureWriter {
+public:
+    explicit CaptureWriter(const std::string& path);
+
+    void Write(Timestamp timestamp, const std::uint8_t* packet, Bytes len);
+
+private:
+    std::mutex mutex_;
+    std::ofstream out_;
+};
@@ -1,219 +1,458 @@
 #include "exchange.h"
 
+#include "capture.h"
 #include "endian.h"
+#include "feed_channel.h"
 #include "moldudp64.h"
-#include "udp_messenger.h"
+#include "order_flow.h"
 
+#include <algorithm>
 #include <chrono>
-#include <condition_variable>
-#include <cstring>
-#include <deque>
+#include <cstdint>
 #include <iostream>
-#include <mutex>
+#include <memory>
+#include <optional>
 #include <random>
 #include <stdexcept>
 #include <thread>
-#include <unordered_map>
 #include <vector>
 
-#include <arpa/inet.h>
-#include <netinet/in.h>
-#include <unistd.h>
+LevelBook::LevelBook(std::size_t sides, Tick levels)
+    : levels_(levels),
+      quantity_(sides * levels, 0),
+      slots_(sides * levels),
+      positions_(sides * levels),
+      active_(sides, 0) {
+
+    // every tick starts out free
+    for (std::size_t side = 0; side < sides; ++side) {
+        for (Tick tick = 0; tick < levels; ++tick) {
+            slots_[Index(side, tick)] = tick;
+            positions_[Index(side, tick)] = tick;
+        }
+    }
+}
+
+void LevelBook::Activate(std::size_t side, Tick tick) {
+    // move 'tick' to the first free slot, then grow the live range over it
+    SwapSlots(side, positions_[Index(side, tick)], active_[side]);
+    ++active_[side];
+}
+
+void LevelBook::Release(std::size_t side, Tick tick) {
+    // move 'tick' to the last live slot, then shrink the live range past it
+    --active_[side];
+    SwapSlots(side, positions_[Index(side, tick)], active_[side]);
+    quantity_[Index(side, tick)] = 0;
+}
 
-BookState::BookState() {
-    avail_prices.reserve(kMaxPrice);
+void LevelBook::SwapSlots(std::size_t side, std::size_t a, std::size_t b) {
+    const Tick tick_a = slots_[Index(side, a)];
+    const Tick tick_b = slots_[Index(side, b)];
 
-    for (int i = 1; i <= kMaxPrice; ++i) {
-        avail_prices.push_back(static_cast<Price>(i));
+    slots_[Index(side, a)] = tick_b;
+    slots_[Index(side, b)] = tick_a;
+    positions_[Index(side, tick_a)] = static_cast<Tick>(b);
+    positions_[Index(side, tick_b)] = static_cast<Tick>(a);
+}
+
+static std::size_t InstrumentCount(const ExchangeConfig& config) {
+    if (config.max_instrument_id < config.min_instrument_id) {
+        throw std::runtime_error("Error: MAX_INSTRUMENT_ID must be >= MIN_INSTRUMENT_ID.");
+    }
+    return static_cast<std::size_t>(config.max_instrument_id - config.min_instrument_id) + 1;
+}
+
+static Tick PriceLevels(const ExchangeConfig& config) {
+    if (config.price_levels < 1 || config.price_levels > kMaxPriceLevels) {
+        throw std::runtime_error("Error: PRICE_LEVELS must be in [1, " + std::to_string(kMaxPriceLevels) + "].");
     }
+    return static_cast<Tick>(config.price_levels);
 }
 
 ExchangeSimulator::ExchangeSimulator()
-    : sockfd_(socket(AF_INET, SOCK_DGRAM, 0)),
-      config_(ExchangeConfig::New()),
-      generate_id_(config_.min_instrument_id, config_.max_instrument_id),
+    : config_(ExchangeConfig::New()),
+      levels_(InstrumentCount(config_) * 2, PriceLevels(config_)),
+      generate_instrument_(0, InstrumentCount(config_) - 1),
       generate_side_(0, 1),
       generate_event_(1, 100),
-      generate_price_(config_.min_price, config_.max_price),
       generate_quantity_(config_.min_quantity, config_.max_quantity),
-      generate_interval_(config_.min_interval_ms, config_.max_interval_ms) {
+      generate_interval_(config_.min_interval_ms, config_.max_interval_ms),
+      flow_(config_) {
 
-    if (sockfd_ < 0) throw std::runtime_error("Error: socket creation to exchange failed.");
+    // Split the instrument range into contiguous, near-equal partitions, one per channel
+    const std::size_t instruments = InstrumentCount(config_);
+    const std::size_t channels = std::clamp<std::size_t>(static_cast<std::size_t>(std::max(config_.channels, 1)), 1, std::min(instruments, kMaxChannels));
+    instruments_per_channel_ = (instruments + channels - 1) / channels;
 
-    memset(&plantaddr_, 0, sizeof(plantaddr_));
-    plantaddr_.sin_family = AF_INET;
-    plantaddr_.sin_port = htons(config_.exchange_port);
-    plantaddr_.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (!config_.record_file.empty()) recorder_ = std::make_unique<CaptureWriter>(config_.record_file);
 
-    if (bind(sockfd_, reinterpret_cast<sockaddr*>(&plantaddr_), sizeof(plantaddr_)) < 0) {
-        close(sockfd_);
-        sockfd_ = -1;
-        throw std::runtime_error("Error: bind failed.");
+    channels_.reserve(channels);
+    for (std::size_t i = 0; i < channels; ++i) {
+        const std::uint64_t seed = config_.impairment_seed ? config_.impairment_seed + 2 * i : number_generator_();
+        channels_.push_back(std::make_unique<FeedChannel>(i, config_, seed, recorder_.get()));
     }
 
-    {
-        std::lock_guard<std::mutex> lock(history_mutex_);
-        events_history_.resize(kMaxExchangeEvents);
+    // Each instrument quotes 'levels' ticks of its own tick size, placed at a random floor inside [min_price, max_price]
+    const Tick levels = PriceLevels(config_);
+    const Price min_tick = std::max<Price>(config_.min_tick_size, 1);
+    const Price max_tick = std::max(config_.max_tick_size, min_tick);
+    std::uniform_int_distribution<Price> generate_tick_size(min_tick, max_tick);
+
+    // A band must fit at the largest tick size, or its top levels would quote past MAX_PRICE
+    if (static_cast<std::int64_t>(levels - 1) * max_tick > static_cast<std::int64_t>(config_.max_price) - config_.min_price) {
+        throw std::runtime_error("Error: (PRICE_LEVELS - 1) * MAX_TICK_SIZE must not exceed MAX_PRICE - MIN_PRICE.");
     }
+
+    bands_.resize(InstrumentCount(config_));
+    for (PriceBand& band : bands_) {
+        band.tick_size = generate_tick_size(number_generator_);
+
+        const Price span = static_cast<Price>(levels - 1) * band.tick_size;
+        std::uniform_int_distribution<Price> generate_floor(config_.min_price, config_.max_price - span);
+        band.floor = generate_floor(number_generator_);
+    }
+
+    if (config_.feed_mode == FeedMode::kOrders) orders_.resize(bands_.size() * 2);
+
+    if (config_.flow_model == FlowModel::kHawkes) {
+        if (levels < 3) throw std::runtime_error("Error: FLOW_MODEL=hawkes requires PRICE_LEVELS >= 3.");
+        mids_.assign(bands_.size(), static_cast<Tick>(levels / 2));
+    }
+
+    std::cout << "Simulating " << bands_.size() << " instrument(s) with " << levels << " price levels per side on "
+              << channels_.size() << " channel(s)" << (orders_.empty() ? "" : " as order-level messages") << ".\n";
 }
 
-void ExchangeSimulator::SendDatagrams() {
-    UdpMessenger messenger(sockfd_, config_.plant_ip.c_str(), config_.plant_port);
+void ExchangeSimulator::GenerateMarketEvents() {
+    Clock::time_point next_event = Clock::now();
 
     while (true) {
+        const bool orders = config_.feed_mode == FeedMode::kOrders;
+
+        if (config_.flow_model == FlowModel::kHawkes) {
+            orders ? GenerateOrderEvent() : GenerateFlowEvent();
 
-        // wait for event
-        std::unique_lock<std::mutex> lock(queue_mutex_);
-        while (events_queue_.empty()) {
-            cv_.wait(lock);
+            // absolute schedule: falling behind produces a burst instead of drifting the arrival process
+            next_event += flow_.NextArrival(number_generator_);
+            std::this_thread::sleep_until(next_event);
+        } else {
+            orders ? GenerateOrderEvent() : GenerateUniformEvent();
+
+            Timestamp sleep = static_cast<Timestamp>(generate_interval_(number_generator_));
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleep));
         }
+    }
+}
 
-        EventToSend next = events_queue_.front(); 
-        events_queue_.pop_front();
+void ExchangeSimulator::ReplayCapture() {
+    CaptureReader reader(config_.replay_file, config_.replay_port);
+    CapturedPacket packet;
 
-        lock.unlock();
+    do {
+        std::uint64_t packets = 0;
+        std::uint64_t messages = 0;
+        std::uint64_t skipped = 0;
 
-        std::uint8_t buf[kPacketSize];
-        SerializeEvent(buf, next);
+        std::optional<Timestamp> first_timestamp;
+        const Clock::time_point start = Clock::now();
 
-        messenger.SendDatagram(buf, kPacketSize);
-    }
-}
+        while (reader.Next(packet)) {
+            const std::uint8_t* buf = packet.data.data();
+            const Bytes len = packet.data.size();
 
-void ExchangeSimulator::GenerateMarketEvents() {
-    while (true) {
-        const InstrumentId id = static_cast<InstrumentId>(generate_id_(number_generator_));
-        const Side side = static_cast<Side>(generate_side_(number_generator_));
-        BookState& book = GetBook(id, side);
-
-        const bool add_level = book.levels.empty() || generate_event_(number_generator_) <= config_.chance_of_add;
-        
-        MarketEvent e{};
-
-        if (add_level) {
-            // update live state
-            const Quantity quantity = static_cast<Quantity>(generate_quantity_(number_generator_));
-
-            // decide new price or existing price
-            const bool new_price = generate_event_(number_generator_) <= config_.chance_of_new_price;
-
-            Price price;
-
-            if (book.levels.empty() || new_price) {
-                price = PickNewPrice(book.avail_prices);
-                book.levels[price] = quantity;
-            } else {
-                auto it = PickExistingPrice(book);
-                price = it->first;
-                book.levels[price] += quantity;
+            PacketHeader header;
+            try {
+                header = ParsePacketHeader(buf, len);
+            } catch (const PacketTruncatedError& e) {
+                ++skipped;
+                continue;
             }
-            
-            e.instrument_id = id;
-            e.side = side;
-            e.event = LevelEvent::kAddLevel;
-            e.price = price;
-            e.quantity = quantity;
-            e.exchange_ts = CurrentTime();
-            
-        } else {
-            auto it = PickExistingPrice(book);
-            const Price price = it->first;
-            const Quantity curr_quantity = it->second;
-
-            const bool delete_level = generate_event_(number_generator_) <= config_.chance_of_delete;
-            Quantity quantity_to_remove;
-
-            if (delete_level) {
-                quantity_to_remove = curr_quantity;
-                ReleasePrice(book, price);
-            } else {
-                std::uniform_int_distribution<Quantity> generate_quantity_to_remove(1, curr_quantity - 1);
-                quantity_to_remove = generate_quantity_to_remove(number_generator_);
-                it->second -= quantity_to_remove;
+
+            // Heartbeats, end-of-session markers and retransmission requests carry no messages
+            if (header.message_count == 0 || len <= kHeaderLength) {
+                ++skipped;
+                continue;
             }
 
-            e.instrument_id = id;
-            e.side = side;
-            e.event = LevelEvent::kModifyLevel;
-            e.price = price;
-            e.quantity = quantity_to_remove;
-            e.exchange_ts = CurrentTime();
-        }
-        
-        SequenceNumber seq;
-        {
-            std::lock_guard<std::mutex> lock(history_mutex_);
-            seq = sequence_number_++;
-            events_history_[seq] = e;
+            if (!first_timestamp) first_timestamp = packet.timestamp;
+
+            if (config_.replay_speed > 0) {
+                const Timestamp elapsed = packet.timestamp > *first_timestamp ? packet.timestamp - *first_timestamp : 0;
+                const double scaled = static_cast<double>(elapsed) / config_.replay_speed;
+                std::this_thread::sleep_until(start + std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(scaled)));
+            }
+
+            // Each message block is re-sequenced on the channel that owns its instrument
+            Bytes offset = kHeaderLength;
+            for (MessageCount i = 0; i < header.message_count; ++i) {
+                if (offset + kMessageHeaderLength > len) break;
+                const MessageDataSize message_len = ReadBigEndian<MessageDataSize>(buf, offset);
+                offset += kMessageHeaderLength;
+                if (offset + message_len > len) break;
+
+                if (message_len < sizeof(InstrumentId) || message_len > kMaxMessageSize) {
+                    ++skipped;
+                } else {
+                    ChannelFor(ReadBigEndian<InstrumentId>(buf, offset)).Publish(buf + offset, message_len);
+                    ++messages;
+                }
+                offset += message_len;
+            }
+            ++packets;
         }
 
-        EnqueueEvent(e, seq);
-        
-        Timestamp sleep = static_cast<Timestamp>(generate_interval_(number_generator_));
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep));
-    }
+        std::cout << "Replayed " << packets << " packet(s) / " << messages << " message(s) from "
+                  << config_.replay_file << " (" << skipped << " skipped).\n";
+        std::cout.flush();
+
+        reader.Rewind();
+    } while (config_.replay_loop);
 }
 
-void ExchangeSimulator::Retransmitter() {
-    PacketHeader header;
-    while (true) {
-        std::uint8_t buf[kHeaderLength];
-        
-        ssize_t bytes_received = recvfrom(sockfd_, buf, kHeaderLength, 0, nullptr, nullptr);
-        if (bytes_received <= 0) continue;
-
-        try {
-            header = ParsePacketHeader(buf, static_cast<Bytes>(bytes_received));
-        } catch (const PacketTruncatedError& e) {
-            std::cerr << e.what() << "\n";
-            continue;
-        }
+void ExchangeSimulator::GenerateUniformEvent() {
+    const std::size_t instrument = generate_instrument_(number_generator_);
+    const Side side = static_cast<Side>(generate_side_(number_generator_));
+    const std::size_t book = BookSide(instrument, side);
 
-        if (std::memcmp(header.session, session_, kSessionLength) == 0) {
-            for (MessageCount i = 0; i < header.message_count; ++i) {
-                std::lock_guard<std::mutex> lock(history_mutex_);
+    const bool add_level = levels_.Active(book) == 0 || generate_event_(number_generator_) <= config_.chance_of_add;
+
+    if (!add_level) {
+        PublishEvent(ReduceLevel(instrument, side));
+        return;
+    }
+
+    // update live state
+    const Quantity quantity = static_cast<Quantity>(generate_quantity_(number_generator_));
+
+    // decide new price or existing price (a full band can only grow existing levels)
+    const bool new_price = generate_event_(number_generator_) <= config_.chance_of_new_price;
+
+    Tick tick;
+
+    if (levels_.Free(book) > 0 && (levels_.Active(book) == 0 || new_price)) {
+        tick = PickNewTick(book);
+        levels_.Activate(book, tick);
+        levels_.Level(book, tick) = quantity;
+    } else {
+        tick = PickExistingTick(book);
+        levels_.Level(book, tick) += quantity;
+    }
+
+    MarketEvent e{};
+    e.instrument_id = static_cast<InstrumentId>(config_.min_instrument_id) + static_cast<InstrumentId>(instrument);
+    e.side = side;
+    e.event = LevelEvent::kAddLevel;
+    e.price = bands_[instrument].ToPrice(tick);
+    e.quantity = quantity;
+    e.exchange_ts = CurrentTime();
+
+    PublishEvent(e);
+}
 
-                const SequenceNumber seq = header.sequence_number + i;
-                if (seq >= sequence_number_) break;
-                EnqueueEvent(events_history_[seq], seq);
+void ExchangeSimulator::GenerateFlowEvent() {
+    const std::size_t instrument = generate_instrument_(number_generator_);
+    const Side side = static_cast<Side>(generate_side_(number_generator_));
+    const std::size_t book = BookSide(instrument, side);
+    const PriceBand& band = bands_[instrument];
+    const InstrumentId id = static_cast<InstrumentId>(config_.min_instrument_id) + static_cast<InstrumentId>(instrument);
+    const std::size_t levels = levels_.Active(book) + levels_.Free(book);
+
+    Tick& mid = mids_[instrument];
+
+    // Random-walk the mid; the opposite level it moves onto is consumed
+    // INVARIANT: bids < mid < asks
+    if (const int move = flow_.Drift(number_generator_)) {
+        const int next_mid = std::clamp(static_cast<int>(mid) + move, 1, static_cast<int>(levels) - 2);
+
+        if (next_mid != static_cast<int>(mid)) {
+            mid = static_cast<Tick>(next_mid);
+
+            const Side crossed = move > 0 ? Side::kAsk : Side::kBid;
+            const std::size_t crossed_book = BookSide(instrument, crossed);
+
+            if (levels_.IsActive(crossed_book, mid)) {
+                MarketEvent e{};
+                e.instrument_id = id;
+                e.side = crossed;
+                e.event = LevelEvent::kModifyLevel;
+                e.price = band.ToPrice(mid);
+                e.quantity = levels_.Level(crossed_book, mid);
+                e.exchange_ts = CurrentTime();
+
+                levels_.Release(crossed_book, mid);
+                PublishEvent(e);
             }
         }
     }
+
+    const bool add_level = levels_.Active(book) == 0 || generate_event_(number_generator_) <= config_.chance_of_add;
+
+    if (!add_level) {
+        PublishEvent(ReduceLevel(instrument, side));
+        return;
+    }
+
+    // Place at a power-law distance behind the mid
+    const std::size_t max_distance = side == Side::kBid ? mid : levels - 1 - mid;
+    const std::size_t distance = flow_.Distance(number_generator_, max_distance);
+    const Tick tick = static_cast<Tick>(side == Side::kBid ? mid - distance : mid + distance);
+    const Quantity quantity = flow_.Size(number_generator_);
+
+    if (levels_.IsActive(book, tick)) {
+        levels_.Level(book, tick) += quantity;
+    } else {
+        levels_.Activate(book, tick);
+        levels_.Level(book, tick) = quantity;
+    }
+
+    MarketEvent e{};
+    e.instrument_id = id;
+    e.side = side;
+    e.event = LevelEvent::kAddLevel;
+    e.price = band.ToPrice(tick);
+    e.quantity = quantity;
+    e.exchange_ts = CurrentTime();
+
+    PublishEvent(e);
 }
 
-void ExchangeSimulator::EnqueueEvent(const MarketEvent& e, const SequenceNumber sequence_number) {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    events_queue_.push_back(EventToSend{e, sequence_number});
-    cv_.notify_one();
+void ExchangeSimulator::GenerateOrderEvent() {
+    const std::size_t instrument = generate_instrument_(number_generator_);
+    const Side side = static_cast<Side>(generate_side_(number_generator_));
+    const std::size_t book = BookSide(instrument, side);
+    const PriceBand& band = bands_[instrument];
+    std::vector<SimulatedOrder>& orders = orders_[book];
+
+    MarketEvent e{};
+    e.instrument_id = static_cast<InstrumentId>(config_.min_instrument_id) + static_cast<InstrumentId>(instrument);
+    e.side = side;
+    e.exchange_ts = CurrentTime();
+
+    if (orders.empty() || generate_event_(number_generator_) <= config_.chance_of_add) {
+        const Tick tick = PickOrderTick(book);
+        e.event = LevelEvent::kAddOrder;
+        e.price = band.ToPrice(tick);
+        e.quantity = static_cast<Quantity>(generate_quantity_(number_generator_));
+        e.order_id = RestOrder(book, tick, e.quantity);
+
+        PublishEvent(e);
+        return;
+    }
+
+    std::uniform_int_distribution<std::size_t> generate_idx(0, orders.size() - 1);
+    const std::size_t index = generate_idx(number_generator_);
+    const SimulatedOrder order = orders[index];
+
+    e.order_id = order.id;
+    e.price = band.ToPrice(order.tick);
+
+    if (order.quantity <= 1 || generate_event_(number_generator_) <= config_.chance_of_delete) {
+        e.event = LevelEvent::kCancelOrder;
+        e.quantity = order.quantity;
+        ReduceOrder(book, index, order.quantity);
+    } else if (generate_side_(number_generator_) == 0) {
+        std::uniform_int_distribution<Quantity> generate_quantity_to_execute(1, order.quantity - 1);
+        e.event = LevelEvent::kExecuteOrder;
+        e.quantity = generate_quantity_to_execute(number_generator_);
+        ReduceOrder(book, index, e.quantity);
+    } else {
+        // Replacing loses time priority: the order is re-rested under a new id
+        ReduceOrder(book, index, order.quantity);
+
+        const Tick tick = PickOrderTick(book);
+        e.event = LevelEvent::kReplaceOrder;
+        e.price = band.ToPrice(tick);
+        e.quantity = static_cast<Quantity>(generate_quantity_(number_generator_));
+        e.new_order_id = RestOrder(book, tick, e.quantity);
+    }
+
+    PublishEvent(e);
+}
+
+OrderId ExchangeSimulator::RestOrder(std::size_t book, Tick tick, Quantity quantity) {
+    if (!levels_.IsActive(book, tick)) levels_.Activate(book, tick);
+    levels_.Level(book, tick) += quantity;
+
+    orders_[book].push_back(SimulatedOrder{next_order_id_, tick, quantity});
+    return next_order_id_++;
 }
 
-Price ExchangeSimulator::PickNewPrice(std::vector<Price>& avail_prices) {
-    std::uniform_int_distribution<std::size_t> generate_idx(0, avail_prices.size() - 1);
-    std::size_t i = generate_idx(number_generator_);
+void ExchangeSimulator::ReduceOrder(std::size_t book, std::size_t index, Quantity quantity) {
+    std::vector<SimulatedOrder>& orders = orders_[book];
+    SimulatedOrder& order = orders[index];
+
+    order.quantity -= quantity;
+    levels_.Level(book, order.tick) -= quantity;
+    if (levels_.Level(book, order.tick) == 0) levels_.Release(book, order.tick);
 
-    Price p = avail_prices[i];
-    avail_prices[i] = avail_prices.back();
-    avail_prices.pop_back();
-    return p;
+    if (order.quantity == 0) {
+        order = orders.back();
+        orders.pop_back();
+    }
+}
+
+Tick ExchangeSimulator::PickOrderTick(std::size_t book) {
+    const bool new_price = generate_event_(number_generator_) <= config_.chance_of_new_price;
+    if (levels_.Free(book) > 0 && (levels_.Active(book) == 0 || new_price)) return PickNewTick(book);
+    return PickExistingTick(book);
 }
 
-std::unordered_map<Price, Quantity>::iterator ExchangeSimulator::PickExistingPrice(BookState& book) {
-    std::uniform_int_distribution<std::size_t> generate_it(0, book.levels.size() - 1);
-    std::size_t skip = generate_it(number_generator_);
+MarketEvent ExchangeSimulator::ReduceLevel(std::size_t instrument, Side side) {
+    const std::size_t book = BookSide(instrument, side);
+    const Tick tick = PickExistingTick(book);
+    Quantity& curr_quantity = levels_.Level(book, tick);
+
+    const bool delete_level = curr_quantity <= 1 || generate_event_(number_generator_) <= config_.chance_of_delete;
+    Quantity quantity_to_remove;
+
+    if (delete_level) {
+        quantity_to_remove = curr_quantity;
+        levels_.Release(book, tick);
+    } else {
+        std::uniform_int_distribution<Quantity> generate_quantity_to_remove(1, curr_quantity - 1);
+        quantity_to_remove = generate_quantity_to_remove(number_generator_);
+        curr_quantity -= quantity_to_remove;
+    }
 
-    auto it = book.levels.begin();
-    std::advance(it, skip);
-    return it;
+    MarketEvent e{};
+    e.instrument_id = static_cast<InstrumentId>(config_.min_instrument_id) + static_cast<InstrumentId>(instrument);
+    e.side = side;
+    e.event = LevelEvent::kModifyLevel;
+    e.price = bands_[instrument].ToPrice(tick);
+    e.quantity = quantity_to_remove;
+    e.exchange_ts = CurrentTime();
+    return e;
 }
-    
-void ExchangeSimulator::ReleasePrice(BookState& book, Price price_to_release) {
-    book.levels.erase(price_to_release);
-    book.avail_prices.push_back(price_to_release);
+
+void ExchangeSimulator::PublishEvent(const MarketEvent& e) {
+    std::uint8_t payload[kMaxMessageSize];
+    const MessageDataSize len = SerializeEvent(payload, e);
+
+    ChannelFor(e.instrument_id).Publish(payload, len);
 }
 
-void ExchangeSimulator::SerializeEvent(std::uint8_t* buf, const EventToSend& next) {
-    const MarketEvent& event = next.event;
-    Bytes offset = WriteMoldUDP64Header(buf, next.sequence_number);
+FeedChannel& ExchangeSimulator::ChannelFor(InstrumentId id) {
+    const InstrumentId min_id = static_cast<InstrumentId>(config_.min_instrument_id);
+    const std::size_t instrument = static_cast<std::size_t>(id - min_id);
+
+    // Instruments outside the simulated range (ex. replayed captures) are spread by id
+    if (id < min_id || instrument >= bands_.size()) return *channels_[id % channels_.size()];
+    return *channels_[instrument / instruments_per_channel_];
+}
+
+Tick ExchangeSimulator::PickNewTick(std::size_t side) {
+    std::uniform_int_distribution<std::size_t> generate_idx(0, levels_.Free(side) - 1);
+    return levels_.FreeTick(side, generate_idx(number_generator_));
+}
+
+Tick ExchangeSimulator::PickExistingTick(std::size_t side) {
+    std::uniform_int_distribution<std::size_t> generate_idx(0, levels_.Active(side) - 1);
+    return levels_.ActiveTick(side, generate_idx(number_generator_));
+}
+
+MessageDataSize ExchangeSimulator::SerializeEvent(std::uint8_t* buf, const MarketEvent& event) {
+    Bytes offset = 0;
 
     WriteBigEndian<InstrumentId>(buf, offset, event.instrument_id);
     offset += sizeof(InstrumentId);
@@ -231,27 +470,19 @@ void ExchangeSimulator::SerializeEvent(std::uint8_t* buf, const EventToSend& nex
     offset += sizeof(Quantity);
 
     WriteBigEndian<Timestamp>(buf, offset, event.exchange_ts);
-    
-}
-
-Bytes ExchangeSimulator::WriteMoldUDP64Header(std::uint8_t* buf, SequenceNumber sequence_number) {
-    Bytes offset = 0;
-
-    std::memcpy(buf, session_, kSessionLength);
-    offset += kSessionLength;
+    offset += sizeof(Timestamp);
 
-    WriteBigEndian<SequenceNumber>(buf, offset, sequence_number);
-    offset += sizeof(SequenceNumber);
+    if (IsOrderEvent(event.event)) {
+        WriteBigEndian<OrderId>(buf, offset, event.order_id);
+        offset += sizeof(OrderId);
 
-    WriteBigEndian<MessageCount>(buf, offset, kMessageCount);
-    offset += sizeof(MessageCount);
-
-    const Bytes remaining = kPacketSize - (offset + sizeof(MessageDataSize));
-    WriteBigEndian<MessageDataSize>(buf, offset, static_cast<MessageDataSize>(remaining));
-
-    offset += sizeof(MessageDataSize);
+        if (event.event == LevelEvent::kReplaceOrder) {
+            WriteBigEndian<OrderId>(buf, offset, event.new_order_id);
+            offset += sizeof(OrderId);
+        }
+    }
 
-    return offset;
+    return static_cast<MessageDataSize>(offset);
 }
 
 Timestamp ExchangeSimulator::CurrentTime() {
@@ -260,20 +491,26 @@ Timestamp ExchangeSimulator::CurrentTime() {
     );
 }
 
-BookState& ExchangeSimulator::GetBook(InstrumentId id, Side side) {
-    if (side == Side::kBid) return books_[id].bids;
-    else return books_[id].asks;
-}
-
-
 int main() {
     ExchangeSimulator exchange;
-    
-    std::thread sender([&] {exchange.SendDatagrams(); } );
-    std::thread generator([&] {exchange.GenerateMarketEvents(); } );
-    std::thread retransmitter([&]{ exchange.Retransmitter(); });
+
+    std::vector<std::thread> channel_threads;
+    for (auto& channel : exchange.channels()) {
+        channel_threads.emplace_back([&channel] { channel->SendDatagrams(); });
+        channel_threads.emplace_back([&channel] { channel->Retransmitter(); });
+    }
+    std::thread generator([&] {
+        if (!exchange.config().replay_file.empty()) {
+            exchange.ReplayCapture();
+        } else {
+            exchange.GenerateMarketEvents();
+        }
+    });
 
     std::cout << "Exchange simulator has started.\n";
 
     generator.join();
+
+    // keep serving retransmissions once a replay has finished
+    for (auto& channel_thread : channel_threads) channel_thread.join();
 }
\ No newline at end of file
@@ -1,36 +1,71 @@
 #pragma once
 
+#include "capture.h"
 #include "event.h"
 #include "exchange_config.h"
+#include "feed_channel.h"
+#include "order_flow.h"
 
-#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
-#include <deque>
-#include <mutex>
+#include <limits>
+#include <memory>
 #include <random>
-#include <unordered_map>
 #include <vector>
 
-#include <netinet/in.h>
-#include <sys/socket.h>
+struct PriceBand {
+    Price floor;
+    Price tick_size;
 
-inline constexpr int kMaxPrice = 100;
+    Price ToPrice(Tick tick) const { return floor + static_cast<Price>(tick) * tick_size; }
+};
 
-struct BookState {
-    std::unordered_map<Price, Quantity> levels;
-    std::vector<Price> avail_prices;
+/*
+Dense level state for every book side of the simulated universe.
 
-    BookState();
-};
+Each side owns 'levels' consecutive ticks of its instrument's price band. The ticks of a side
+are kept in an indexable set: slots [0, active) hold live levels and slots [active, levels)
+hold free ones, so picking, adding and releasing a level are O(1) with no per-level allocation.
+*/
+class LevelBook {
+public:
+    LevelBook(std::size_t sides, Tick levels);
+
+    std::size_t Active(std::size_t side) const { return active_[side]; }
+
+    std::size_t Free(std::size_t side) const { return levels_ - active_[side]; }
+
+    // i in [0, Active(side))
+    Tick ActiveTick(std::size_t side, std::size_t i) const { return slots_[Index(side, i)]; }
+
+    // i in [0, Free(side))
+    Tick FreeTick(std::size_t side, std::size_t i) const { return slots_[Index(side, active_[side] + i)]; }
+
+    bool IsActive(std::size_t side, Tick tick) const { return positions_[Index(side, tick)] < active_[side]; }
+
+    Quantity& Level(std::size_t side, Tick tick) { return quantity_[Index(side, tick)]; }
+
+    void Activate(std::size_t side, Tick tick);
+
+    void Release(std::size_t side, Tick tick);
+
+private:
+    std::size_t Index(std::size_t side, std::size_t i) const { return side * levels_ + i; }
+
+    void SwapSlots(std::size_t side, std::size_t a, std::size_t b);
 
-struct InstrumentState {
-    BookState bids;
-    BookState asks;
+    std::size_t levels_;
+    std::vector<Quantity> quantity_;        // quantity_[side * levels + tick]
+    std::vector<Tick> slots_;               // slots_[side * levels + slot] = tick
+    std::vector<Tick> positions_;           // positions_[side * levels + tick] = slot
+    std::vector<std::uint32_t> active_;     // live levels per side
 };
 
-struct EventToSend {
-    MarketEvent event;
-    SequenceNumber sequence_number;
+// Resting order of the simulated book (FEED_MODE=orders)
+struct SimulatedOrder {
+    OrderId id;
+    Tick tick;
+    Quantity quantity;
 };
 
 class ExchangeSimulator {
@@ -38,54 +73,80 @@ public:
 
     ExchangeSimulator();
 
-    void SendDatagrams();
-
     void GenerateMarketEvents();
 
+    // Re-sequences every message of a recorded capture onto the feed channels, preserving
+    // inter-packet timing scaled by REPLAY_SPEED
+    void ReplayCapture();
+
     void GenerateHeartbeats();
 
-    void Retransmitter();
+    std::vector<std::unique_ptr<FeedChannel>>& channels() { return channels_; }
+
+    const ExchangeConfig& config() const { return config_; }
 
 private:
 
-    void EnqueueEvent(const MarketEvent& e, SequenceNumber sequence_number);
+    // Uniform prices and event types across the whole band
+    void GenerateUniformEvent();
 
-    Price PickNewPrice(std::vector<Price>& avail_prices);
+    // Clustered, power-law placement around a drifting mid (FLOW_MODEL=hawkes)
+    void GenerateFlowEvent();
 
-    std::unordered_map<Price, Quantity>::iterator PickExistingPrice(BookState& book);
-    
-    void ReleasePrice(BookState& book, Price price_to_release);
+    // Adds, cancels, executes or replaces a random order with uniform prices (FEED_MODE=orders)
+    void GenerateOrderEvent();
 
-    void SerializeEvent(std::uint8_t* buf, const EventToSend& next);
+    // Reduces (or deletes) a random live level on 'side'
+    MarketEvent ReduceLevel(std::size_t instrument, Side side);
 
-    Bytes WriteMoldUDP64Header(std::uint8_t* buf, SequenceNumber sequence_number);
+    // Rests a new order on 'tick' of 'book' and adds its quantity to the level
+    OrderId RestOrder(std::size_t book, Tick tick, Quantity quantity);
 
-    static Timestamp CurrentTime();
+    // Takes 'quantity' off the order at 'index' of 'book', removing it once empty
+    void ReduceOrder(std::size_t book, std::size_t index, Quantity quantity);
+
+    // A free tick of 'book' if a new price is drawn (or nothing is live), otherwise a live one
+    Tick PickOrderTick(std::size_t book);
+
+    // Serializes 'e' and publishes it on the channel that owns its instrument
+    void PublishEvent(const MarketEvent& e);
+
+    FeedChannel& ChannelFor(InstrumentId id);
 
-    BookState& GetBook(InstrumentId id, Side side);
+    Tick PickNewTick(std::size_t side);
 
-    // network
-    int sockfd_{-1};
-    sockaddr_in plantaddr_{};
+    Tick PickExistingTick(std::size_t side);
+
+    static MessageDataSize SerializeEvent(std::uint8_t* buf, const MarketEvent& event);
+
+    static Timestamp CurrentTime();
+
+    static std::size_t BookSide(std::size_t instrument, Side side) {
+        return instrument * 2 + static_cast<std::size_t>(side);
+    }
 
     ExchangeConfig config_;
-    inline static constexpr char session_[kSessionLength] = {'E','X','C','H','A','N','G','E','I','D'};
+    std::unique_ptr<CaptureWriter> recorder_;
+
+    // channels_[i] publishes a contiguous range of instrument indices
+    std::vector<std::unique_ptr<FeedChannel>> channels_;
+    std::size_t instruments_per_channel_{1};
+
+    // Live Exchange State (instruments are indexed densely from 'min_instrument_id')
+    std::vector<PriceBand> bands_;
+    std::vector<Tick> mids_;    // FLOW_MODEL=hawkes only
+    LevelBook levels_;
 
-    // Live Exchange State
-    std::unordered_map<InstrumentId, InstrumentState> books_;
-    std::deque<EventToSend> events_queue_;
-    std::vector<MarketEvent> events_history_;  // events[sequence_number]
-    std::uint64_t sequence_number_{0};
-    std::mutex queue_mutex_;
-    std::mutex history_mutex_;
-    std::condition_variable cv_;
+    // FEED_MODE=orders only: resting orders per book side (unordered) and the next order id
+    std::vector<std::vector<SimulatedOrder>> orders_;
+    OrderId next_order_id_{1};
 
     // Generators
     std::mt19937_64 number_generator_{std::random_device{}()};
-    std::uniform_int_distribution<int> generate_id_;
+    std::uniform_int_distribution<std::size_t> generate_instrument_;
     std::uniform_int_distribution<int> generate_side_;
     std::uniform_int_distribution<int> generate_event_;
-    std::uniform_int_distribution<Price> generate_price_;
     std::uniform_int_distribution<Quantity> generate_quantity_;
     std::uniform_int_distribution<int> generate_interval_;
+    OrderFlowModel flow_;
 };
\ No newline at end of file
@@ -2,9 +2,16 @@
 
 #include "event.h"
 #include <string>
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
+
+// Ticks index a band's price levels
+using Tick = std::uint16_t;
+
+inline constexpr int kMaxPriceLevels = std::numeric_limits<Tick>::max();
 
 
 inline std::string get_env(const std::string &key, const std::string &default_value) {
@@ -17,12 +24,96 @@ inline int get_env_int(const std::string &key, int default_value) {
     return (value != nullptr) ? std::atoi(value) : default_value;
 }
 
+inline std::uint64_t get_env_uint64(const std::string &key, std::uint64_t default_value) {
+    const char* value = std::getenv(key.c_str());
+    return (value != nullptr) ? std::strtoull(value, nullptr, 10) : default_value;
+}
+
+inline double get_env_double(const std::string &key, double default_value) {
+    const char* value = std::getenv(key.c_str());
+    return (value != nullptr) ? std::atof(value) : default_value;
+}
+
+// Send-path impairments, configured separately for the live and retransmission paths.
+// Rates are per-datagram probabilities in [0, 1].
+struct ImpairmentConfig {
+    // Bernoulli loss
+    double loss_rate;
+
+    // Burst loss (Gilbert-Elliott): every datagram is dropped while in the burst state
+    double burst_enter_rate;
+    double burst_exit_rate;
+
+    // Bounded reordering: a datagram is held back behind at most 'reorder_depth' later datagrams
+    // (sent or dropped), and for at most 'reorder_max_hold_us' when the path goes quiet
+    double reorder_rate;
+    int reorder_depth;
+    int reorder_max_hold_us;
+
+    double duplicate_rate;
+
+    // Added delay, uniform in [0, jitter_us] (FIFO order is preserved)
+    int jitter_us;
+
+    bool Enabled() const {
+        return loss_rate > 0 || burst_enter_rate > 0 || reorder_rate > 0 || duplicate_rate > 0 || jitter_us > 0;
+    }
+
+    // 'prefix' selects the path, ex. "LIVE_" or "RETX_"
+    static ImpairmentConfig New(const std::string& prefix) {
+        ImpairmentConfig config;
+
+        config.loss_rate = get_env_double(prefix + "LOSS_RATE", 0.0);
+        config.burst_enter_rate = get_env_double(prefix + "BURST_ENTER_RATE", 0.0);
+        config.burst_exit_rate = get_env_double(prefix + "BURST_EXIT_RATE", 0.5);
+        config.reorder_rate = get_env_double(prefix + "REORDER_RATE", 0.0);
+        config.reorder_depth = get_env_int(prefix + "REORDER_DEPTH", 3);
+        config.reorder_max_hold_us = get_env_int(prefix + "REORDER_MAX_HOLD_US", 1000);
+        config.duplicate_rate = get_env_double(prefix + "DUPLICATE_RATE", 0.0);
+        config.jitter_us = get_env_int(prefix + "JITTER_US", 0);
+
+        return config;
+    }
+};
+
+enum class FlowModel {
+    kUniform,   // uniform event types, prices and sizes
+    kHawkes,    // clustered arrivals, power-law placement around a drifting mid
+};
+
+inline FlowModel ParseFlowModel(const std::string& name) {
+    if (name == "hawkes") return FlowModel::kHawkes;
+    return FlowModel::kUniform;
+}
+
+enum class FeedMode {
+    kLevels,    // aggregated price-level deltas
+    kOrders,    // order-by-order (L3) messages: add, cancel, execute, replace
+};
+
+inline FeedMode ParseFeedMode(const std::string& name) {
+    if (name == "orders") return FeedMode::kOrders;
+    return FeedMode::kLevels;
+}
+
 struct ExchangeConfig {
     // Network
     std::string plant_ip;
     std::uint16_t plant_port;
     std::uint16_t exchange_port;
+
+    // Channels: instrument ranges are split across 'channels' independent MoldUDP64 sessions.
+    // Channel i binds 'exchange_port + i * stride' and sends to 'plant_port + i * stride',
+    // or to 'plant_port' for every channel when the plant shares one SO_REUSEPORT port.
+    // FEED_CHANNELS, CHANNEL_PORT_STRIDE and FEED_REUSEPORT are the same variables the plant reads.
+    int channels;
+    int channel_port_stride;
+    bool feed_reuseport;
+    int retransmission_history;     // messages kept per channel for retransmission
     
+    // Message granularity (FEED_MODE=orders publishes individual orders instead of level deltas)
+    FeedMode feed_mode;
+
     // Market generation probabilities
     int chance_of_add;
     int chance_of_delete;
@@ -36,11 +127,41 @@ struct ExchangeConfig {
     int min_instrument_id;
     int max_instrument_id;
     
+    // Price bands: every instrument quotes 'price_levels' ticks of 'tick_size' inside [min_price, max_price].
+    // At most kMaxPriceLevels; level state costs 8 bytes per tick, side and instrument.
     Price min_price;
     Price max_price;
+    Price min_tick_size;
+    Price max_tick_size;
+    int price_levels;
+
     Quantity min_quantity;
     Quantity max_quantity;
 
+    // Stochastic order flow (FLOW_MODEL=hawkes)
+    FlowModel flow_model;
+    double hawkes_base_rate;        // background events per second
+    double hawkes_branching_ratio;  // expected events triggered by each event, < 1
+    double hawkes_decay;            // excitation decay rate per second
+    double price_tail_exponent;     // P(distance from mid > d ticks) ~ d^-exponent
+    double size_log_mean;           // log-normal order size
+    double size_log_sigma;
+    Quantity lot_size;
+    double mid_drift_rate;          // probability the mid moves one tick per event
+
+    // Capture replay/recording
+    std::string replay_file;        // replay this capture instead of generating events
+    double replay_speed;            // 1.0 = original timing, 0 = as fast as possible
+    bool replay_loop;
+    std::uint16_t replay_port;      // pcap only: UDP destination port filter (0 = any)
+    std::string record_file;        // record every published packet
+
+    // Network impairments
+    ImpairmentConfig live_impairment;
+    ImpairmentConfig retransmission_impairment;
+    std::uint64_t impairment_seed;
+    int impairment_log_interval_ms;
+
     static ExchangeConfig New() {
 
         ExchangeConfig config;
@@ -49,7 +170,14 @@ struct ExchangeConfig {
 
         config.plant_port = static_cast<std::uint16_t>(get_env_int("PLANT_PORT", 9001));
         config.exchange_port = static_cast<std::uint16_t>(get_env_int("EXCHANGE_PORT", 9000));
+
+        config.channels = get_env_int("FEED_CHANNELS", 1);
+        config.channel_port_stride = get_env_int("CHANNEL_PORT_STRIDE", 2);
+        config.feed_reuseport = get_env_int("FEED_REUSEPORT", 0) != 0;
+        config.retransmission_history = get_env_int("RETRANSMISSION_HISTORY", static_cast<int>(kMaxExchangeEvents));
         
+        config.feed_mode = ParseFeedMode(get_env("FEED_MODE", "levels"));
+
         config.chance_of_add = get_env_int("CHANCE_OF_ADD", 55);
         config.chance_of_delete = get_env_int("CHANCE_OF_DELETE", 50);
         config.chance_of_new_price = get_env_int("CHANCE_OF_NEW_PRICE", 50);
@@ -62,8 +190,35 @@ struct ExchangeConfig {
         
         config.min_price = static_cast<Price>(get_env_int("MIN_PRICE", 1));
         config.max_price = static_cast<Price>(get_env_int("MAX_PRICE", 100));
+        config.min_tick_size = static_cast<Price>(get_env_int("MIN_TICK_SIZE", 1));
+        config.max_tick_size = static_cast<Price>(get_env_int("MAX_TICK_SIZE", 1));
+        // By default a band spans the whole price range at the largest tick size
+        const std::int64_t price_range = static_cast<std::int64_t>(config.max_price) - config.min_price;
+        const std::int64_t band_levels = price_range / std::max<std::int64_t>(config.max_tick_size, 1) + 1;
+        config.price_levels = get_env_int("PRICE_LEVELS", static_cast<int>(std::clamp<std::int64_t>(band_levels, 1, kMaxPriceLevels)));
         config.min_quantity = static_cast<Quantity>(get_env_int("MIN_QUANTITY", 1));
         config.max_quantity = static_cast<Quantity>(get_env_int("MAX_QUANTITY", 100));
+
+        config.flow_model = ParseFlowModel(get_env("FLOW_MODEL", "uniform"));
+        config.hawkes_base_rate = get_env_double("HAWKES_BASE_RATE", 20.0);
+        config.hawkes_branching_ratio = get_env_double("HAWKES_BRANCHING_RATIO", 0.7);
+        config.hawkes_decay = get_env_double("HAWKES_DECAY", 50.0);
+        config.price_tail_exponent = get_env_double("PRICE_TAIL_EXPONENT", 1.5);
+        config.size_log_mean = get_env_double("SIZE_LOG_MEAN", 3.0);
+        config.size_log_sigma = get_env_double("SIZE_LOG_SIGMA", 1.0);
+        config.lot_size = static_cast<Quantity>(get_env_int("LOT_SIZE", 1));
+        config.mid_drift_rate = get_env_double("MID_DRIFT_RATE", 0.05);
+
+        config.replay_file = get_env("REPLAY_FILE", "");
+        config.replay_speed = get_env_double("REPLAY_SPEED", 1.0);
+        config.replay_loop = get_env_int("REPLAY_LOOP", 0) != 0;
+        config.replay_port = static_cast<std::uint16_t>(get_env_int("REPLAY_PORT", 0));
+        config.record_file = get_env("RECORD_FILE", "");
+
+        config.live_impairment = ImpairmentConfig::New("LIVE_");
+        config.retransmission_impairment = ImpairmentConfig::New("RETX_");
+        config.impairment_seed = get_env_uint64("IMPAIRMENT_SEED", 0);
+        config.impairment_log_interval_ms = get_env_int("IMPAIRMENT_LOG_INTERVAL_MS", 5000);
         
         return config;
     }
@@ -0,0 +1,195 @@
+#include "feed_channel.h"
+
+#include "endian.h"
+#include "moldudp64.h"
+#include "udp_messenger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+FeedChannel::FeedChannel(std::size_t index, const ExchangeConfig& config, std::uint64_t seed, CaptureWriter* recorder)
+    : index_(index),
+      sockfd_(socket(AF_INET, SOCK_DGRAM, 0)),
+      plant_ip_(config.plant_ip),
+      plant_port_(static_cast<std::uint16_t>(config.plant_port + (config.feed_reuseport ? 0 : static_cast<int>(index) * config.channel_port_stride))),
+      log_interval_ms_(config.impairment_log_interval_ms),
+      history_(static_cast<std::size_t>(std::max(config.retransmission_history, 1))),
+      recorder_(recorder),
+      live_impairment_("live:" + std::to_string(index), config.live_impairment, seed),
+      retransmission_impairment_("retransmission:" + std::to_string(index), config.retransmission_impairment, seed + 1) {
+
+    if (sockfd_ < 0) throw std::runtime_error("Error: socket creation to exchange failed.");
+
+    // Session: "EXCHANGE" followed by the two-digit channel index
+    char session[kSessionLength + 1];
+    std::snprintf(session, sizeof(session), "EXCHANGE%02zu", index % kMaxChannels);
+    std::memcpy(session_, session, kSessionLength);
+
+    sockaddr_in exaddr{};
+    exaddr.sin_family = AF_INET;
+    exaddr.sin_port = htons(static_cast<std::uint16_t>(config.exchange_port + static_cast<int>(index) * config.channel_port_stride));
+    exaddr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    if (bind(sockfd_, reinterpret_cast<sockaddr*>(&exaddr), sizeof(exaddr)) < 0) {
+        close(sockfd_);
+        sockfd_ = -1;
+        throw std::runtime_error("Error: bind failed.");
+    }
+}
+
+FeedChannel::~FeedChannel() {
+    if (sockfd_ >= 0) close(sockfd_);
+}
+
+void FeedChannel::Publish(const std::uint8_t* payload, MessageDataSize len) {
+    StoredMessage message;
+    message.len = std::min(len, kMaxMessageSize);
+    std::memcpy(message.data.data(), payload, message.len);
+
+    SequenceNumber seq;
+    {
+        std::lock_guard<std::mutex> lock(history_mutex_);
+        seq = sequence_number_++;
+        history_[seq % history_.size()] = message;
+    }
+
+    if (recorder_) {
+        std::uint8_t buf[kMaxPacketSize];
+        const Bytes packet_len = SerializePacket(buf, EventToSend{message, seq, false});
+        recorder_->Write(CurrentTime(), buf, packet_len);
+    }
+
+    EnqueueEvent(message, seq, false);
+}
+
+void FeedChannel::SendDatagrams() {
+    UdpMessenger messenger(sockfd_, plant_ip_, plant_port_);
+
+    const bool log_impairments = live_impairment_.enabled() || retransmission_impairment_.enabled();
+    const auto log_interval = std::chrono::milliseconds(log_interval_ms_);
+    Clock::time_point next_log = Clock::now() + log_interval;
+
+    while (true) {
+        std::optional<EventToSend> next;
+
+        {
+            // wait for event, or until a delayed datagram is due
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+
+            std::optional<Clock::time_point> deadline = live_impairment_.NextRelease();
+            if (auto retransmission = retransmission_impairment_.NextRelease()) {
+                deadline = deadline ? std::min(*deadline, *retransmission) : retransmission;
+            }
+            if (log_impairments) deadline = deadline ? std::min(*deadline, next_log) : next_log;
+
+            while (events_queue_.empty()) {
+                if (!deadline) {
+                    cv_.wait(lock);
+                } else if (cv_.wait_until(lock, *deadline) == std::cv_status::timeout) {
+                    break;
+                }
+            }
+
+            if (!events_queue_.empty()) {
+                next = events_queue_.front();
+                events_queue_.pop_front();
+            }
+        }
+
+        const Clock::time_point now = Clock::now();
+
+        if (next) {
+            std::uint8_t buf[kMaxPacketSize];
+            const Bytes len = SerializePacket(buf, *next);
+
+            NetworkImpairment& path = next->retransmission ? retransmission_impairment_ : live_impairment_;
+            path.Submit(messenger, buf, len, now);
+        }
+
+        live_impairment_.Flush(messenger, now);
+        retransmission_impairment_.Flush(messenger, now);
+
+        if (log_impairments && now >= next_log) {
+            LogImpairments();
+            next_log = now + log_interval;
+        }
+    }
+}
+
+void FeedChannel::Retransmitter() {
+    PacketHeader header;
+    while (true) {
+        std::uint8_t buf[kHeaderLength];
+
+        ssize_t bytes_received = recvfrom(sockfd_, buf, kHeaderLength, 0, nullptr, nullptr);
+        if (bytes_received <= 0) continue;
+
+        try {
+            header = ParsePacketHeader(buf, static_cast<Bytes>(bytes_received));
+        } catch (const PacketTruncatedError& e) {
+            std::cerr << e.what() << "\n";
+            continue;
+        }
+
+        if (std::memcmp(header.session, session_, kSessionLength) == 0) {
+            for (MessageCount i = 0; i < header.message_count; ++i) {
+                std::lock_guard<std::mutex> lock(history_mutex_);
+
+                const SequenceNumber seq = header.sequence_number + i;
+                if (seq >= sequence_number_) break;
+
+                // Requests older than the history window can no longer be served
+                if (sequence_number_ - seq > history_.size()) continue;
+                EnqueueEvent(history_[seq % history_.size()], seq, true);
+            }
+        }
+    }
+}
+
+void FeedChannel::EnqueueEvent(const StoredMessage& message, SequenceNumber sequence_number, bool retransmission) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    events_queue_.push_back(EventToSend{message, sequence_number, retransmission});
+    cv_.notify_one();
+}
+
+Bytes FeedChannel::SerializePacket(std::uint8_t* buf, const EventToSend& next) const {
+    Bytes offset = 0;
+
+    std::memcpy(buf, session_, kSessionLength);
+    offset += kSessionLength;
+
+    WriteBigEndian<SequenceNumber>(buf, offset, next.sequence_number);
+    offset += sizeof(SequenceNumber);
+
+    WriteBigEndian<MessageCount>(buf, offset, kMessageCount);
+    offset += sizeof(MessageCount);
+
+    WriteBigEndian<MessageDataSize>(buf, offset, next.message.len);
+    offset += sizeof(MessageDataSize);
+
+    std::memcpy(buf + offset, next.message.data.data(), next.message.len);
+    return offset + next.message.len;
+}
+
+Timestamp FeedChannel::CurrentTime() {
+    return static_cast<Timestamp>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()
+    );
+}
+
+void FeedChannel::LogImpairments() const {
+    live_impairment_.LogStats();
+    retransmission_impairment_.LogStats();
+    std::cout.flush();
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "capture.h"
+#include "event.h"
+#include "exchange_config.h"
+#include "impairment.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+inline constexpr std::size_t kMaxChannels = 100;
+inline constexpr MessageDataSize kMaxMessageSize = 64;
+
+// Largest packet SerializePacket builds: MoldUDP64 header, one message length and the message
+inline constexpr Bytes kMaxPacketSize = kSessionLength + sizeof(SequenceNumber) + sizeof(MessageCount) + sizeof(MessageDataSize) + kMaxMessageSize;
+static_assert(kMaxPacketSize <= kMaxDatagramSize, "impaired paths must be able to hold every packet");
+
+// Message payload (without MoldUDP64 framing)
+struct StoredMessage {
+    MessageDataSize len = 0;
+    std::array<std::uint8_t, kMaxMessageSize> data{};
+};
+
+struct EventToSend {
+    StoredMessage message;
+    SequenceNumber sequence_number;
+    bool retransmission = false;
+};
+
+/*
+One MoldUDP64 channel of the exchange feed: its own session, sequence space, socket,
+retransmission history and send-path impairments.
+*/
+class FeedChannel {
+public:
+    // 'recorder' (optional) receives every published packet before impairments are applied
+    FeedChannel(std::size_t index, const ExchangeConfig& config, std::uint64_t seed, CaptureWriter* recorder = nullptr);
+
+    ~FeedChannel();
+
+    FeedChannel(const FeedChannel& other) = delete;
+    FeedChannel& operator=(const FeedChannel& other) = delete;
+
+    // Assigns the next sequence number to 'payload', records it and queues it for sending
+    void Publish(const std::uint8_t* payload, MessageDataSize len);
+
+    void SendDatagrams();
+
+    void Retransmitter();
+
+    std::size_t index() const { return index_; }
+
+private:
+    void EnqueueEvent(const StoredMessage& message, SequenceNumber sequence_number, bool retransmission);
+
+    Bytes SerializePacket(std::uint8_t* buf, const EventToSend& next) const;
+
+    static Timestamp CurrentTime();
+
+    void LogImpairments() const;
+
+    std::size_t index_;
+    int sockfd_{-1};
+    std::string plant_ip_;
+    std::uint16_t plant_port_;
+    int log_interval_ms_;
+    char session_[kSessionLength];
+
+    // history_[sequence_number % history_.size()]
+    std::vector<StoredMessage> history_;
+    SequenceNumber sequence_number_{0};
+    std::mutex history_mutex_;
+
+    std::deque<EventToSend> events_queue_;
+    std::mutex queue_mutex_;
+    std::condition_variable cv_;
+
+    CaptureWriter* recorder_;
+
+    // Send-path impairments (sender thread only)
+    NetworkImpairment live_impairment_;
+    NetworkImpairment retransmission_impairment_;
+};
@@ -0,0 +1,158 @@
+#include "impairment.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+NetworkImpairment::NetworkImpairment(std::string name, const ImpairmentConfig& config, std::uint64_t seed)
+    : name_(std::move(name)), config_(config), generator_(seed) {}
+
+void NetworkImpairment::Submit(const UdpMessenger& messenger, const std::uint8_t* buf, Bytes len, Clock::time_point now) {
+    ++stats_.submitted;
+
+    if (!config_.Enabled()) [[likely]] {
+        Flush(messenger, now);
+        messenger.SendDatagram(buf, len);
+        ++stats_.sent;
+        return;
+    }
+
+    // Held and scheduled datagrams are copied into fixed buffers; a larger one is dropped, never cut short
+    if (len > kMaxDatagramSize) [[unlikely]] {
+        ++stats_.oversized;
+        Flush(messenger, now);
+        return;
+    }
+
+    // Burst loss is evaluated first so that a burst swallows every datagram while it lasts.
+    // A dropped datagram still passed the held ones, so it counts toward their countdown.
+    if (DropInBurst()) {
+        ++stats_.dropped_burst;
+        ReleaseHeld();
+    } else if (Chance(config_.loss_rate)) {
+        ++stats_.dropped_random;
+        ReleaseHeld();
+    } else if (config_.reorder_depth > 0 && Chance(config_.reorder_rate)) {
+        std::uniform_int_distribution<int> generate_depth(1, config_.reorder_depth);
+
+        HeldDatagram held{};
+        held.datagram.len = len;
+        std::memcpy(held.datagram.data.data(), buf, len);
+        held.remaining = generate_depth(generator_);
+        held.deadline = now + std::chrono::microseconds(config_.reorder_max_hold_us);
+        held_.push_back(held);
+        ++stats_.reordered;
+    } else {
+        Schedule(buf, len, now);
+        if (Chance(config_.duplicate_rate)) {
+            Schedule(buf, len, now);
+            ++stats_.duplicated;
+        }
+        ReleaseHeld();
+    }
+
+    Flush(messenger, now);
+}
+
+void NetworkImpairment::Flush(const UdpMessenger& messenger, Clock::time_point now) {
+    ReleaseExpired(now);
+
+    while (!scheduled_.empty() && scheduled_.front().release <= now) {
+        const Datagram& next = scheduled_.front();
+        messenger.SendDatagram(next.data.data(), next.len);
+        ++stats_.sent;
+        scheduled_.pop_front();
+    }
+}
+
+std::optional<Clock::time_point> NetworkImpairment::NextRelease() const {
+    std::optional<Clock::time_point> next;
+    if (!scheduled_.empty()) next = scheduled_.front().release;
+    for (const HeldDatagram& held : held_) {
+        if (!next || held.deadline < *next) next = held.deadline;
+    }
+    return next;
+}
+
+void NetworkImpairment::LogStats() const {
+    std::cout << "[impairment:" << name_ << "]"
+              << " submitted=" << stats_.submitted
+              << " sent=" << stats_.sent
+              << " dropped_random=" << stats_.dropped_random
+              << " dropped_burst=" << stats_.dropped_burst
+              << " bursts=" << stats_.bursts
+              << " duplicated=" << stats_.duplicated
+              << " reordered=" << stats_.reordered
+              << " hold_expired=" << stats_.hold_expired
+              << " delayed=" << stats_.delayed
+              << " oversized=" << stats_.oversized
+              << " held=" << held_.size()
+              << " scheduled=" << scheduled_.size() << "\n";
+}
+
+bool NetworkImpairment::Chance(double rate) {
+    return rate > 0 && probability_(generator_) < rate;
+}
+
+bool NetworkImpairment::DropInBurst() {
+    // Two-state Markov chain: transitions are evaluated once per datagram
+    if (in_burst_) {
+        if (Chance(config_.burst_exit_rate)) in_burst_ = false;
+    } else if (Chance(config_.burst_enter_rate)) {
+        in_burst_ = true;
+        ++stats_.bursts;
+    }
+    return in_burst_;
+}
+
+void NetworkImpairment::Schedule(const std::uint8_t* buf, Bytes len, Clock::time_point now) {
+    Clock::time_point release = now;
+
+    if (config_.jitter_us > 0) {
+        std::uniform_int_distribution<int> generate_jitter(0, config_.jitter_us);
+        const int jitter = generate_jitter(generator_);
+        if (jitter > 0) {
+            release += std::chrono::microseconds(jitter);
+            ++stats_.delayed;
+        }
+    }
+
+    // Delay never overtakes an earlier datagram; reordering is injected separately
+    release = std::max(release, last_release_);
+    last_release_ = release;
+
+    Datagram& datagram = scheduled_.emplace_back();
+    datagram.release = release;
+    datagram.len = len;
+    std::memcpy(datagram.data.data(), buf, len);
+}
+
+void NetworkImpairment::ReleaseHeld() {
+    // Held datagrams go out directly behind the datagram that completed their countdown
+    for (auto it = held_.begin(); it != held_.end(); ) {
+        if (--it->remaining > 0) {
+            ++it;
+            continue;
+        }
+        Datagram& datagram = scheduled_.emplace_back(it->datagram);
+        datagram.release = last_release_;
+        it = held_.erase(it);
+    }
+}
+
+void NetworkImpairment::ReleaseExpired(Clock::time_point now) {
+    // A quiet path would otherwise hold a datagram until the next submit; release it in hold order
+    for (auto it = held_.begin(); it != held_.end(); ) {
+        if (it->deadline > now) {
+            ++it;
+            continue;
+        }
+        last_release_ = std::max(last_release_, now);
+        Datagram& datagram = scheduled_.emplace_back(it->datagram);
+        datagram.release = last_release_;
+        it = held_.erase(it);
+        ++stats_.hold_expired;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "event.h"
+#include "exchange_config.h"
+#include "moldudp64.h"
+#include "udp_messenger.h"
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <random>
+#include <string>
+
+inline constexpr Bytes kMaxDatagramSize = 512;
+
+// Ground-truth counters for one send path
+struct ImpairmentStats {
+    std::uint64_t submitted = 0;
+    std::uint64_t sent = 0;
+    std::uint64_t dropped_random = 0;
+    std::uint64_t dropped_burst = 0;
+    std::uint64_t bursts = 0;
+    std::uint64_t duplicated = 0;
+    std::uint64_t reordered = 0;
+    std::uint64_t hold_expired = 0;     // held datagrams released by their deadline, not their countdown
+    std::uint64_t delayed = 0;
+    std::uint64_t oversized = 0;        // dropped: larger than kMaxDatagramSize
+};
+
+/*
+Injects loss, reordering, duplication and delay on a single send path.
+Not thread-safe: owned and driven by the sender thread.
+*/
+class NetworkImpairment {
+public:
+    NetworkImpairment(std::string name, const ImpairmentConfig& config, std::uint64_t seed);
+
+    // Applies impairments to the datagram, then sends everything that is due
+    void Submit(const UdpMessenger& messenger, const std::uint8_t* buf, Bytes len, Clock::time_point now);
+
+    // Releases held datagrams past their deadline, then sends every scheduled datagram whose release time has passed
+    void Flush(const UdpMessenger& messenger, Clock::time_point now);
+
+    // Release time of the next scheduled datagram or held-datagram deadline, if any
+    std::optional<Clock::time_point> NextRelease() const;
+
+    void LogStats() const;
+
+    bool enabled() const { return config_.Enabled(); }
+
+    const ImpairmentStats& stats() const { return stats_; }
+
+private:
+    struct Datagram {
+        Clock::time_point release;
+        Bytes len;
+        std::array<std::uint8_t, kMaxDatagramSize> data;
+    };
+
+    struct HeldDatagram {
+        Datagram datagram;
+        int remaining;                  // later datagrams to let through before this one
+        Clock::time_point deadline;     // released regardless of 'remaining' once this passes
+    };
+
+    bool Chance(double rate);
+
+    bool DropInBurst();
+
+    void Schedule(const std::uint8_t* buf, Bytes len, Clock::time_point now);
+
+    void ReleaseHeld();
+
+    void ReleaseExpired(Clock::time_point now);
+
+    std::string name_;
+    ImpairmentConfig config_;
+    ImpairmentStats stats_;
+
+    bool in_burst_ = false;
+    Clock::time_point last_release_{};
+
+    // FIFO of datagrams waiting for their release time
+    std::deque<Datagram> scheduled_;
+
+    // Datagrams held back for reordering
+    std::deque<HeldDatagram> held_;
+
+    std::mt19937_64 generator_;
+    std::uniform_real_distribution<double> probability_{0.0, 1.0};
+};
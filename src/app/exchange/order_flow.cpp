@@ -0,0 +1,58 @@
+#include "order_flow.h"
+
+#include <algorithm>
+#include <cmath>
+
+HawkesProcess::HawkesProcess(double base_rate, double branching_ratio, double decay)
+    : base_rate_(std::max(base_rate, 1e-9)),
+      excitation_(std::clamp(branching_ratio, 0.0, 0.99) * decay),
+      decay_(decay),
+      intensity_(base_rate_) {}
+
+std::chrono::nanoseconds HawkesProcess::NextArrival(std::mt19937_64& generator) {
+    std::uniform_real_distribution<double> probability(0.0, 1.0);
+    double elapsed = 0.0;
+
+    // Intensity only decays between events, so the current intensity bounds it until the next one
+    while (true) {
+        const double bound = intensity_;
+        std::exponential_distribution<double> wait(bound);
+        const double step = wait(generator);
+        elapsed += step;
+
+        intensity_ = base_rate_ + (intensity_ - base_rate_) * std::exp(-decay_ * step);
+        if (probability(generator) * bound <= intensity_) break;
+    }
+
+    intensity_ += excitation_;
+    return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(elapsed * 1e9));
+}
+
+OrderFlowModel::OrderFlowModel(const ExchangeConfig& config)
+    : arrivals_(config.hawkes_base_rate, config.hawkes_branching_ratio, config.hawkes_decay),
+      tail_exponent_(std::max(config.price_tail_exponent, 0.1)),
+      lot_size_(std::max<Quantity>(config.lot_size, 1)),
+      max_quantity_(std::max(config.max_quantity, lot_size_)),
+      drift_rate_(config.mid_drift_rate),
+      size_(config.size_log_mean, config.size_log_sigma) {}
+
+std::size_t OrderFlowModel::Distance(std::mt19937_64& generator, std::size_t max_distance) {
+    // Pareto tail: P(distance > d) = d^-exponent, redrawn when it falls outside the band
+    for (int i = 0; i < kMaxDistanceDraws; ++i) {
+        const double u = 1.0 - probability_(generator);
+        const double distance = std::floor(std::pow(u, -1.0 / tail_exponent_));
+        if (distance <= static_cast<double>(max_distance)) return static_cast<std::size_t>(distance);
+    }
+    return max_distance;
+}
+
+Quantity OrderFlowModel::Size(std::mt19937_64& generator) {
+    const double lots = std::round(size_(generator) / static_cast<double>(lot_size_));
+    const double quantity = std::max(lots, 1.0) * static_cast<double>(lot_size_);
+    return static_cast<Quantity>(std::min(quantity, static_cast<double>(max_quantity_)));
+}
+
+int OrderFlowModel::Drift(std::mt19937_64& generator) {
+    if (probability_(generator) >= drift_rate_) return 0;
+    return probability_(generator) < 0.5 ? -1 : 1;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "event.h"
+#include "exchange_config.h"
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+
+/*
+Self-exciting (Hawkes) arrival process with an exponential kernel.
+Every event raises the intensity by 'excitation', which then decays back towards the base rate.
+*/
+class HawkesProcess {
+public:
+    HawkesProcess(double base_rate, double branching_ratio, double decay);
+
+    // Time until the next event (Ogata thinning); the event's excitation is applied on return
+    std::chrono::nanoseconds NextArrival(std::mt19937_64& generator);
+
+    double intensity() const { return intensity_; }
+
+private:
+    double base_rate_;
+    double excitation_;
+    double decay_;
+    double intensity_;
+};
+
+/*
+Samplers for the stochastic order-flow mode: clustered arrivals, power-law placement
+distance from the mid, log-normal round-lot sizes and a random-walk mid.
+*/
+class OrderFlowModel {
+public:
+    explicit OrderFlowModel(const ExchangeConfig& config);
+
+    std::chrono::nanoseconds NextArrival(std::mt19937_64& generator) { return arrivals_.NextArrival(generator); }
+
+    // Distance from the mid in ticks, in [1, max_distance] (requires max_distance >= 1)
+    std::size_t Distance(std::mt19937_64& generator, std::size_t max_distance);
+
+    Quantity Size(std::mt19937_64& generator);
+
+    // Mid move in ticks: -1, 0 or +1
+    int Drift(std::mt19937_64& generator);
+
+private:
+    static constexpr int kMaxDistanceDraws = 8;
+
+    HawkesProcess arrivals_;
+    double tail_exponent_;
+    Quantity lot_size_;
+    Quantity max_quantity_;
+    double drift_rate_;
+
+    std::uniform_real_distribution<double> probability_{0.0, 1.0};
+    std::lognormal_distribution<double> size_;
+};
@@ -39,6 +39,16 @@ void MarketDataSubscriber::HandleEvent(const ms::OrderBookEventUpdate& event) {
                 else (*asks_levels)[price] -= quantity;
             }
             break;
+
+        case ms::SET_LEVEL:
+            if (levels) {
+                if (quantity == 0) levels->erase(price);
+                else (*levels)[price] = quantity;
+            } else if (asks_levels) {
+                if (quantity == 0) asks_levels->erase(price);
+                else (*asks_levels)[price] = quantity;
+            }
+            break;
             
         default: 
             break;
@@ -52,6 +62,16 @@ void MarketDataSubscriber::HandleSnapshot(const ms::SnapshotUpdate& snapshot) {
     for (const auto& event : snapshot.asks()) HandleEvent(event);
 }
 
+void MarketDataSubscriber::HandleUpdate(const ms::OrderBookUpdate& update) {
+    if (update.has_snapshot()) {
+        HandleSnapshot(update.snapshot());
+    } else if (update.has_incremental()) {
+        HandleEvent(update.incremental().update());
+    } else if (update.has_batch()) {
+        for (const auto& event : update.batch().updates()) HandleEvent(event);
+    }
+}
+
 void MarketDataSubscriber::PrintBookState() {
     std::cout << "\033[2J\033[H";
 
@@ -89,6 +109,9 @@ void MarketDataSubscriber::Run() {
     for (InstrumentId id : config_.instrument_ids) {
         req.mutable_subscribe()->add_ids(id);
     }
+    req.mutable_options()->set_absolute_quantity(config_.absolute_quantity);
+    req.mutable_options()->set_batch_updates(config_.batch_updates);
+    req.mutable_options()->set_conflate_backlog(config_.conflate_backlog);
     
     grpc::ClientContext ctx;
     std::unique_ptr<grpc::ClientReader<ms::StreamResponse>> reader(
@@ -109,16 +132,14 @@ void MarketDataSubscriber::Run() {
             continue;
         }
 
-        if (!resp.has_update()) continue;
-        const auto& upd = resp.update();
-
-        if (upd.has_snapshot()) {
-            HandleSnapshot(upd.snapshot());
-            PrintBookState();
-        } else if (upd.has_incremental()) {
-            HandleEvent(upd.incremental().update());
-            PrintBookState();
+        if (resp.has_update()) {
+            HandleUpdate(resp.update());
+        } else if (resp.has_batch()) {
+            for (const auto& upd : resp.batch().updates()) HandleUpdate(upd);
+        } else {
+            continue;
         }
+        PrintBookState();
     }
 }
 
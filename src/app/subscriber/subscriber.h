@@ -25,6 +25,7 @@ public:
 private:
     void HandleEvent(const ms::OrderBookEventUpdate& event);
     void HandleSnapshot(const ms::SnapshotUpdate& snapshot);
+    void HandleUpdate(const ms::OrderBookUpdate& update);
     void PrintBookState();
     
     SubscriberConfig config_;
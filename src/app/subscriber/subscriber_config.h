@@ -1,6 +1,7 @@
 #pragma once
 
 #include "event.h"
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -22,6 +23,9 @@ struct SubscriberConfig {
     std::uint16_t grpc_port;
     std::vector<InstrumentId> instrument_ids;
     Depth display_depth;
+    bool absolute_quantity;     // request SET_LEVEL updates instead of deltas
+    bool batch_updates;         // request UpdateBatch messages coalescing queued updates
+    std::uint32_t conflate_backlog;     // merge an instrument's backlog past this many updates (0 = off)
 
     static SubscriberConfig New() {
         SubscriberConfig config;
@@ -29,6 +33,9 @@ struct SubscriberConfig {
         config.grpc_host = get_env("GRPC_HOST", "127.0.0.1");
         config.grpc_port = static_cast<std::uint16_t>(get_env_int("GRPC_PORT", 50051));
         config.display_depth = static_cast<Depth>(get_env_int("DISPLAY_DEPTH", 10));
+        config.absolute_quantity = get_env_int("ABSOLUTE_QUANTITY", 0) != 0;
+        config.batch_updates = get_env_int("BATCH_UPDATES", 0) != 0;
+        config.conflate_backlog = static_cast<std::uint32_t>(std::max(get_env_int("CONFLATE_BACKLOG", 0), 0));
         
         std::string ids_str = get_env("INSTRUMENT_IDS", "1");
         std::stringstream ss(ids_str);
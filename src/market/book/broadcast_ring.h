@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+/*
+Single-writer broadcast of a book's published updates to any number of readers.
+
+The writer appends each update once; every reader walks the ring with its own cursor (the
+sequence number of the next update it wants), so publishing costs the same however many
+readers there are. Every slot is a seqlock stamped with the sequence it holds: values are
+copied in and out through 64-bit atomics, and a reader that finds another stamp, or whose
+copy overlapped a write, was lapped and must resync. Nothing is allocated after construction.
+*/
+template <class T>
+class BroadcastRing {
+    static_assert(std::is_trivially_copyable_v<T>, "readers copy values the writer may be overwriting");
+
+public:
+    enum class ReadResult : std::uint8_t {
+        kReady,         // 'out' holds the update at the cursor
+        kPending,       // nothing published at the cursor yet
+        kOverrun,       // the update at the cursor was already overwritten
+    };
+
+    // 'capacity' is rounded up to a power of two
+    explicit BroadcastRing(std::size_t capacity)
+        : mask_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity) - 1),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+
+    // Writer only; the updates become visible to readers together
+    void Publish(std::span<const T> values) {
+        const std::uint64_t first = next_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < values.size(); ++i) Write(first + i, values[i]);
+        next_.store(first + values.size(), std::memory_order_release);
+    }
+
+    // Sequence number the next Publish will use: a new reader's cursor
+    std::uint64_t next() const { return next_.load(std::memory_order_acquire); }
+
+    // Any thread; copies the update at 'cursor' into 'out'
+    ReadResult Read(std::uint64_t cursor, T& out) const {
+        const std::uint64_t next = next_.load(std::memory_order_acquire);
+        if (cursor >= next) return ReadResult::kPending;
+        if (next - cursor > mask_ + 1) return ReadResult::kOverrun;
+
+        // Below 'next', the slot holds 'cursor' or a later sequence (never an earlier one), so
+        // any other stamp, odd ones included, means the writer has moved past it
+        const Slot& slot = slots_[cursor & mask_];
+        const std::uint64_t stamp = Stamp(cursor);
+        if (slot.stamp.load(std::memory_order_acquire) != stamp) return ReadResult::kOverrun;
+
+        Words words;
+        for (std::size_t i = 0; i < kWords; ++i) words[i] = slot.words[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.stamp.load(std::memory_order_relaxed) != stamp) return ReadResult::kOverrun;
+
+        std::memcpy(static_cast<void*>(&out), words.data(), sizeof(T));
+        return ReadResult::kReady;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+    using Words = std::array<std::uint64_t, kWords>;
+
+    // Stamp of a slot holding 'sequence'; one less (odd) while it is being written, 0 before first use
+    static constexpr std::uint64_t Stamp(std::uint64_t sequence) { return (sequence + 1) * 2; }
+
+    void Write(std::uint64_t sequence, const T& value) {
+        Slot& slot = slots_[sequence & mask_];
+        slot.stamp.store(Stamp(sequence) - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        Words words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+        for (std::size_t i = 0; i < kWords; ++i) slot.words[i].store(words[i], std::memory_order_relaxed);
+
+        slot.stamp.store(Stamp(sequence), std::memory_order_release);
+    }
+
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> stamp{0};
+        std::array<std::atomic<std::uint64_t>, kWords> words{};
+    };
+
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(64) std::atomic<std::uint64_t> next_{0};
+};
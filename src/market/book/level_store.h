@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "event.h"
+#include "price_ladder.h"
+
+/*
+Level storage policies for one side of an OrderBook. Every policy exposes:
+
+    bool Add(Price, Quantity)                           true if the level is new
+    std::optional<Quantity> Reduce(Price, Quantity)     quantity before, nothing if the level does not exist
+    Quantity At(Price)                                  0 if there is no level
+    std::optional<PriceLevel> Best()
+    void ForEach(visit)                                 best to worst while visit(price, quantity)
+    std::size_t size(), bool empty()
+
+TreeLevels      ordered map on a per-side node pool: no assumptions about the price range
+FlatLevels      sorted vector: cache friendly for books with few live levels
+PriceLadder     dense tick window with an occupancy bitmap (price_ladder.h)
+*/
+
+template <Side kSide>
+using BetterPrice = std::conditional_t<kSide == Side::kBid, std::greater<Price>, std::less<Price>>;
+
+template <Side kSide>
+class TreeLevels {
+public:
+    explicit TreeLevels(Price tick_size = 1) { (void)tick_size; }
+
+    bool Add(Price price, Quantity quantity) {
+        auto [it, added] = levels_.try_emplace(price, quantity);
+        if (!added) it->second += quantity;
+        return added;
+    }
+
+    std::optional<Quantity> Reduce(Price price, Quantity quantity) {
+        auto it = levels_.find(price);
+        if (it == levels_.end()) [[unlikely]] return std::nullopt;
+
+        const Quantity previous = it->second;
+        if (quantity >= it->second) {
+            levels_.erase(it);
+        } else {
+            it->second -= quantity;
+        }
+        return previous;
+    }
+
+    Quantity At(Price price) const {
+        auto it = levels_.find(price);
+        return it == levels_.end() ? 0 : it->second;
+    }
+
+    std::optional<PriceLevel> Best() const {
+        if (levels_.empty()) return std::nullopt;
+        return PriceLevel{levels_.begin()->first, levels_.begin()->second};
+    }
+
+    template <class Visitor>
+    void ForEach(Visitor&& visit) const {
+        for (const auto& [price, quantity] : levels_) {
+            if (!visit(price, quantity)) return;
+        }
+    }
+
+    std::size_t size() const { return levels_.size(); }
+
+    bool empty() const { return levels_.empty(); }
+
+private:
+    // Declared first: the map returns its nodes to the pool on destruction
+    LevelPool pool_;
+    std::pmr::map<Price, Quantity, BetterPrice<kSide>> levels_{&pool_};
+};
+
+template <Side kSide>
+class FlatLevels {
+public:
+    explicit FlatLevels(Price tick_size = 1) { (void)tick_size; }
+
+    bool Add(Price price, Quantity quantity) {
+        auto it = Find(levels_, price);
+        if (it != levels_.end() && it->price == price) {
+            it->quantity += quantity;
+            return false;
+        }
+        levels_.insert(it, PriceLevel{price, quantity});
+        return true;
+    }
+
+    std::optional<Quantity> Reduce(Price price, Quantity quantity) {
+        auto it = Find(levels_, price);
+        if (it == levels_.end() || it->price != price) [[unlikely]] return std::nullopt;
+
+        const Quantity previous = it->quantity;
+        if (quantity >= it->quantity) {
+            levels_.erase(it);
+        } else {
+            it->quantity -= quantity;
+        }
+        return previous;
+    }
+
+    Quantity At(Price price) const {
+        auto it = Find(levels_, price);
+        return it != levels_.end() && it->price == price ? it->quantity : 0;
+    }
+
+    std::optional<PriceLevel> Best() const {
+        if (levels_.empty()) return std::nullopt;
+        return levels_.back();
+    }
+
+    template <class Visitor>
+    void ForEach(Visitor&& visit) const {
+        for (auto it = levels_.rbegin(); it != levels_.rend(); ++it) {
+            if (!visit(it->price, it->quantity)) return;
+        }
+    }
+
+    std::size_t size() const { return levels_.size(); }
+
+    bool empty() const { return levels_.empty(); }
+
+private:
+    // Levels are kept worst to best so activity near the top of the book shifts the fewest elements
+    template <class Levels>
+    static auto Find(Levels& levels, Price price) {
+        return std::lower_bound(levels.begin(), levels.end(), price, [](const PriceLevel& level, Price p) {
+            return BetterPrice<kSide>{}(p, level.price);
+        });
+    }
+
+    std::vector<PriceLevel> levels_;
+};
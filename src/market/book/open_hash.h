@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+Open-addressing hash map for integer keys: linear probing over a power-of-two slot array,
+kept at most half full, with backward-shift deletion so no tombstones build up under churn.
+
+Sized up front, it never allocates until it grows past that size. Pointers returned by Find /
+TryEmplace are invalidated by the next insert.
+*/
+template <class Key, class Value>
+class OpenHashMap {
+    static_assert(std::is_unsigned_v<Key>, "OpenHashMap keys must be unsigned integers");
+
+public:
+    explicit OpenHashMap(std::size_t capacity = 0) { Rehash(SlotsFor(capacity)); }
+
+    Value* Find(Key key) {
+        for (std::size_t i = Home(key); slots_[i].used; i = Next(i)) {
+            if (slots_[i].key == key) return &slots_[i].value;
+        }
+        return nullptr;
+    }
+
+    // Second is false (and the stored value untouched) if 'key' was present
+    std::pair<Value*, bool> TryEmplace(Key key, const Value& value) {
+        if ((size_ + 1) * 2 > slots_.size()) [[unlikely]] Rehash(slots_.size() * 2);
+
+        std::size_t i = Home(key);
+        for (; slots_[i].used; i = Next(i)) {
+            if (slots_[i].key == key) return {&slots_[i].value, false};
+        }
+        slots_[i] = Slot{key, value, true};
+        ++size_;
+        return {&slots_[i].value, true};
+    }
+
+    bool Erase(Key key) {
+        std::size_t hole = Home(key);
+        for (; slots_[hole].used; hole = Next(hole)) {
+            if (slots_[hole].key == key) break;
+        }
+        if (!slots_[hole].used) return false;
+
+        // Shift later members of the probe run back so every key stays reachable from its home slot
+        for (std::size_t i = Next(hole); slots_[i].used; i = Next(i)) {
+            const std::size_t home = Home(slots_[i].key);
+            if (((i - home) & mask_) >= ((i - hole) & mask_)) {
+                slots_[hole] = slots_[i];
+                hole = i;
+            }
+        }
+        slots_[hole].used = false;
+        --size_;
+        return true;
+    }
+
+    std::size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+private:
+    struct Slot {
+        Key key{};
+        Value value{};
+        bool used = false;
+    };
+
+    static std::size_t SlotsFor(std::size_t capacity) { return std::bit_ceil(std::max<std::size_t>(capacity * 2, 16)); }
+
+    // Fibonacci hashing: sequential keys (ex. order ids) spread over the whole table
+    std::size_t Home(Key key) const {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    std::size_t Next(std::size_t i) const { return (i + 1) & mask_; }
+
+    void Rehash(std::size_t slots) {
+        std::vector<Slot> old = std::exchange(slots_, std::vector<Slot>(slots));
+        mask_ = slots - 1;
+        shift_ = 64 - std::countr_zero(slots);
+        size_ = 0;
+
+        for (const Slot& slot : old) {
+            if (slot.used) TryEmplace(slot.key, slot.value);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::size_t mask_ = 0;
+    int shift_ = 64;
+    std::size_t size_ = 0;
+};
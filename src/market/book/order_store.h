@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "event.h"
+#include "open_hash.h"
+
+/*
+Order-by-order (L3) state of one instrument, reduced to the level events it implies.
+
+Orders are fixed-size nodes in a pool recycled through a free list, indexed by id in an
+open-addressing table, and threaded into an intrusive FIFO per price level (time priority).
+Sized for 'capacity' resting orders up front, steady-state message handling never allocates.
+*/
+class OrderStore {
+public:
+    // A replace moves quantity between two levels; every other message touches one
+    using LevelEvents = std::array<MarketEvent, 2>;
+
+    explicit OrderStore(std::size_t capacity) : index_(capacity), levels_(kInitialLevels) {
+        nodes_.reserve(capacity);
+    }
+
+    // Applies an order-level message; returns how many level events were written to 'out'.
+    // Messages naming an unknown order (or adding a live id) are dropped.
+    std::size_t Apply(const MarketEvent& e, LevelEvents& out) {
+        switch (e.event) {
+            case LevelEvent::kAddOrder:
+                return Add(e.order_id, e.side, e.price, e.quantity, e, out[0]) ? 1 : 0;
+
+            case LevelEvent::kCancelOrder:
+            case LevelEvent::kExecuteOrder: {
+                const NodeIndex* node = index_.Find(e.order_id);
+                if (!node) [[unlikely]] return 0;
+
+                const bool delete_order = e.event == LevelEvent::kCancelOrder && e.quantity == 0;
+                return Reduce(*node, delete_order ? nodes_[*node].quantity : e.quantity, e, out[0]) ? 1 : 0;
+            }
+
+            case LevelEvent::kReplaceOrder: {
+                const NodeIndex* node = index_.Find(e.order_id);
+                if (!node || index_.Find(e.new_order_id)) [[unlikely]] return 0;
+
+                const Side side = nodes_[*node].side;
+                std::size_t n = 0;
+                if (Reduce(*node, nodes_[*node].quantity, e, out[n])) ++n;
+                if (Add(e.new_order_id, side, e.price, e.quantity, e, out[n])) ++n;
+                return n;
+            }
+
+            default:
+                return 0;
+        }
+    }
+
+    // Resting orders at 'price' on 'side' in time priority, while visit(order_id, quantity)
+    template <class Visitor>
+    void ForEachOrder(Side side, Price price, Visitor&& visit) {
+        const OrderQueue* queue = levels_.Find(LevelKey(side, price));
+        if (!queue) return;
+
+        for (NodeIndex i = queue->head; i != kNil; i = nodes_[i].next) {
+            if (!visit(nodes_[i].id, nodes_[i].quantity)) return;
+        }
+    }
+
+    // Resting orders
+    std::size_t size() const { return index_.size(); }
+
+private:
+    using NodeIndex = std::uint32_t;
+
+    static constexpr NodeIndex kNil = std::numeric_limits<NodeIndex>::max();
+    static constexpr std::size_t kInitialLevels = 1024;
+
+    struct OrderNode {
+        OrderId id;
+        Price price;
+        Quantity quantity;
+        NodeIndex prev;
+        NodeIndex next;     // also links free nodes
+        Side side;
+    };
+
+    struct OrderQueue {
+        NodeIndex head = kNil;      // oldest
+        NodeIndex tail = kNil;
+    };
+
+    static std::uint64_t LevelKey(Side side, Price price) {
+        return static_cast<std::uint64_t>(side) << 32 | price;
+    }
+
+    static MarketEvent LevelUpdate(const MarketEvent& e, LevelEvent event, Side side, Price price, Quantity quantity) {
+        MarketEvent update{};
+        update.instrument_id = e.instrument_id;
+        update.side = side;
+        update.event = event;
+        update.price = price;
+        update.quantity = quantity;
+        update.exchange_ts = e.exchange_ts;
+        return update;
+    }
+
+    bool Add(OrderId id, Side side, Price price, Quantity quantity, const MarketEvent& e, MarketEvent& out) {
+        if (quantity == 0) [[unlikely]] return false;
+
+        auto [slot, added] = index_.TryEmplace(id, kNil);
+        if (!added) [[unlikely]] return false;
+
+        const NodeIndex node = Allocate();
+        *slot = node;
+        nodes_[node] = OrderNode{id, price, quantity, kNil, kNil, side};
+
+        // Join the back of the level's queue
+        OrderQueue& queue = *levels_.TryEmplace(LevelKey(side, price), OrderQueue{}).first;
+        nodes_[node].prev = queue.tail;
+        if (queue.tail != kNil) {
+            nodes_[queue.tail].next = node;
+        } else {
+            queue.head = node;
+        }
+        queue.tail = node;
+
+        out = LevelUpdate(e, LevelEvent::kAddLevel, side, price, quantity);
+        return true;
+    }
+
+    bool Reduce(NodeIndex node, Quantity quantity, const MarketEvent& e, MarketEvent& out) {
+        OrderNode& order = nodes_[node];
+        if (quantity == 0) [[unlikely]] return false;
+
+        const Quantity removed = std::min(quantity, order.quantity);
+        out = LevelUpdate(e, LevelEvent::kModifyLevel, order.side, order.price, removed);
+
+        order.quantity -= removed;
+        if (order.quantity == 0) Remove(node);
+        return true;
+    }
+
+    void Remove(NodeIndex node) {
+        const OrderNode& order = nodes_[node];
+        const std::uint64_t key = LevelKey(order.side, order.price);
+        OrderQueue& queue = *levels_.Find(key);
+
+        if (order.prev != kNil) nodes_[order.prev].next = order.next; else queue.head = order.next;
+        if (order.next != kNil) nodes_[order.next].prev = order.prev; else queue.tail = order.prev;
+        if (queue.head == kNil) levels_.Erase(key);
+
+        index_.Erase(order.id);
+        Release(node);
+    }
+
+    NodeIndex Allocate() {
+        if (free_ != kNil) {
+            const NodeIndex node = free_;
+            free_ = nodes_[node].next;
+            return node;
+        }
+        // Past the configured capacity the pool grows (node indices stay valid)
+        nodes_.emplace_back();
+        return static_cast<NodeIndex>(nodes_.size() - 1);
+    }
+
+    void Release(NodeIndex node) {
+        nodes_[node].next = free_;
+        free_ = node;
+    }
+
+    std::vector<OrderNode> nodes_;
+    NodeIndex free_ = kNil;
+
+    OpenHashMap<OrderId, NodeIndex> index_;
+    OpenHashMap<std::uint64_t, OrderQueue> levels_;
+};
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+
+#include "event.h"
+
+struct PriceLevel {
+    Price price;
+    Quantity quantity;
+};
+
+// Node memory of a map-backed level store. Erased levels go back to the pool's free lists, so once
+// a book side has seen its working set of levels, adding and deleting levels makes no heap calls.
+using LevelPool = std::pmr::unsynchronized_pool_resource;
+
+/*
+Dense level store for one side of a book.
+
+Quantities live in a contiguous window of 'kWindowTicks' ticks indexed by
+(price - base) / tick_size. A two-level occupancy bitmap (one summary word over
+64 level words) finds the best price and the next occupied level with a couple of
+find-first-set instructions.
+
+Prices outside the window, or off the window's tick grid, fall back to a sparse
+ordered map. The window re-centers on the best price whenever the best level would
+otherwise live in the fallback, or when the window drains.
+*/
+template <Side kSide>
+class PriceLadder {
+public:
+    static constexpr std::size_t kWordBits = 64;
+    static constexpr std::size_t kWords = 64;
+    static constexpr std::size_t kWindowTicks = kWords * kWordBits;
+
+    explicit PriceLadder(Price tick_size = 1) : tick_size_(tick_size ? tick_size : 1) {}
+
+    // Adds 'quantity' at 'price'; returns true if the level is new
+    bool Add(Price price, Quantity quantity) {
+        std::size_t index = Index(price);
+
+        if (index == kNone) {
+            if (window_levels_ == 0 && overflow_.empty()) {
+                Recenter(price);
+                index = Index(price);
+            } else {
+                auto [it, added] = overflow_.try_emplace(price, quantity);
+                if (!added) {
+                    it->second += quantity;
+                    return false;
+                }
+
+                // Keep the best level dense: move the window to it when it lands on the grid
+                if (it == overflow_.begin() && (window_levels_ == 0 || (Aligned(price) && Better(price, WindowBest())))) {
+                    Recenter(price);
+                }
+                return true;
+            }
+        }
+
+        Quantity& level = quantities_[index];
+        const bool added = level == 0;
+        if (added) Set(index);
+        level += quantity;
+        return added;
+    }
+
+    // Removes up to 'quantity' at 'price' (the level is deleted once it reaches zero).
+    // Returns the level's quantity before, or nothing if the level does not exist.
+    std::optional<Quantity> Reduce(Price price, Quantity quantity) {
+        const std::size_t index = Index(price);
+
+        if (index != kNone && quantities_[index] != 0) {
+            Quantity& level = quantities_[index];
+            const Quantity previous = level;
+            if (quantity >= level) {
+                level = 0;
+                Clear(index);
+                if (window_levels_ == 0 && !overflow_.empty()) Recenter(overflow_.begin()->first);
+            } else {
+                level -= quantity;
+            }
+            return previous;
+        }
+
+        auto it = overflow_.find(price);
+        if (it == overflow_.end()) return std::nullopt;
+
+        const Quantity previous = it->second;
+        if (quantity >= it->second) {
+            overflow_.erase(it);
+        } else {
+            it->second -= quantity;
+        }
+        return previous;
+    }
+
+    // Quantity resting at 'price' (0 if there is no level)
+    Quantity At(Price price) const {
+        const std::size_t index = Index(price);
+        if (index != kNone) return quantities_[index];
+
+        auto it = overflow_.find(price);
+        return it == overflow_.end() ? 0 : it->second;
+    }
+
+    std::optional<PriceLevel> Best() const {
+        std::optional<PriceLevel> best;
+        if (window_levels_ != 0) {
+            const std::size_t index = NextIndex(kFirstIndex);
+            best = PriceLevel{PriceAt(index), quantities_[index]};
+        }
+        if (!overflow_.empty() && (!best || Better(overflow_.begin()->first, best->price))) {
+            best = PriceLevel{overflow_.begin()->first, overflow_.begin()->second};
+        }
+        return best;
+    }
+
+    // Visits levels from best to worst until 'visit(price, quantity)' returns false
+    template <class Visitor>
+    void ForEach(Visitor&& visit) const {
+        std::size_t index = window_levels_ != 0 ? NextIndex(kFirstIndex) : kNone;
+        auto it = overflow_.begin();
+
+        while (index != kNone || it != overflow_.end()) {
+            if (it == overflow_.end() || (index != kNone && Better(PriceAt(index), it->first))) {
+                if (!visit(PriceAt(index), quantities_[index])) return;
+                index = Step(index);
+            } else {
+                if (!visit(it->first, it->second)) return;
+                ++it;
+            }
+        }
+    }
+
+    std::size_t size() const { return window_levels_ + overflow_.size(); }
+
+    bool empty() const { return size() == 0; }
+
+    Price tick_size() const { return tick_size_; }
+
+private:
+    using Compare = std::conditional_t<kSide == Side::kBid, std::greater<Price>, std::less<Price>>;
+
+    static constexpr std::size_t kNone = ~std::size_t{0};
+
+    // Bids are walked from the top of the window down, asks from the bottom up
+    static constexpr std::size_t kFirstIndex = kSide == Side::kBid ? kWindowTicks - 1 : 0;
+
+    static bool Better(Price a, Price b) { return Compare{}(a, b); }
+
+    std::size_t Index(Price price) const {
+        if (price < base_) return kNone;
+        const Price offset = price - base_;
+        if (offset % tick_size_ != 0) return kNone;
+        const std::size_t index = offset / tick_size_;
+        return index < kWindowTicks ? index : kNone;
+    }
+
+    Price PriceAt(std::size_t index) const {
+        return base_ + static_cast<Price>(index) * tick_size_;
+    }
+
+    bool Aligned(Price price) const { return price % tick_size_ == base_ % tick_size_; }
+
+    Price WindowBest() const { return PriceAt(NextIndex(kFirstIndex)); }
+
+    void Set(std::size_t index) {
+        const std::size_t word = index / kWordBits;
+        words_[word] |= std::uint64_t{1} << (index % kWordBits);
+        summary_ |= std::uint64_t{1} << word;
+        ++window_levels_;
+    }
+
+    void Clear(std::size_t index) {
+        const std::size_t word = index / kWordBits;
+        words_[word] &= ~(std::uint64_t{1} << (index % kWordBits));
+        if (words_[word] == 0) summary_ &= ~(std::uint64_t{1} << word);
+        --window_levels_;
+    }
+
+    std::size_t Step(std::size_t index) const {
+        if constexpr (kSide == Side::kBid) {
+            return index == 0 ? kNone : NextIndex(index - 1);
+        } else {
+            return index + 1 == kWindowTicks ? kNone : NextIndex(index + 1);
+        }
+    }
+
+    // First occupied index at or after 'from' in best-to-worst order
+    std::size_t NextIndex(std::size_t from) const {
+        const std::size_t word = from / kWordBits;
+        const std::size_t bit = from % kWordBits;
+
+        if constexpr (kSide == Side::kBid) {
+            // at or below 'from'
+            const std::uint64_t mask = bit == kWordBits - 1 ? ~std::uint64_t{0} : (std::uint64_t{1} << (bit + 1)) - 1;
+            if (const std::uint64_t bits = words_[word] & mask) {
+                return word * kWordBits + (kWordBits - 1 - static_cast<std::size_t>(std::countl_zero(bits)));
+            }
+            const std::uint64_t below = summary_ & ((std::uint64_t{1} << word) - 1);
+            if (below == 0) return kNone;
+            const std::size_t next = kWordBits - 1 - static_cast<std::size_t>(std::countl_zero(below));
+            return next * kWordBits + (kWordBits - 1 - static_cast<std::size_t>(std::countl_zero(words_[next])));
+        } else {
+            // at or above 'from'
+            if (const std::uint64_t bits = words_[word] & (~std::uint64_t{0} << bit)) {
+                return word * kWordBits + static_cast<std::size_t>(std::countr_zero(bits));
+            }
+            const std::uint64_t above = word == kWords - 1 ? 0 : summary_ & (~std::uint64_t{0} << (word + 1));
+            if (above == 0) return kNone;
+            const std::size_t next = static_cast<std::size_t>(std::countr_zero(above));
+            return next * kWordBits + static_cast<std::size_t>(std::countr_zero(words_[next]));
+        }
+    }
+
+    // Moves the window so 'anchor' sits a quarter window from its better edge, leaving room for the
+    // price to improve; levels that no longer fit move to the fallback and vice versa
+    void Recenter(Price anchor) {
+        for (std::size_t index = window_levels_ != 0 ? NextIndex(kFirstIndex) : kNone; index != kNone; index = Step(index)) {
+            overflow_.emplace(PriceAt(index), quantities_[index]);
+            quantities_[index] = 0;
+        }
+        words_.fill(0);
+        summary_ = 0;
+        window_levels_ = 0;
+
+        const std::size_t below = kSide == Side::kBid ? kWindowTicks - kWindowTicks / 4 : kWindowTicks / 4;
+        const std::uint64_t span = static_cast<std::uint64_t>(below) * tick_size_;
+        base_ = anchor >= span ? static_cast<Price>(anchor - span) : anchor % tick_size_;
+
+        for (auto it = overflow_.begin(); it != overflow_.end(); ) {
+            const std::size_t index = Index(it->first);
+            if (index == kNone) {
+                ++it;
+                continue;
+            }
+            quantities_[index] = it->second;
+            Set(index);
+            it = overflow_.erase(it);
+        }
+    }
+
+    Price tick_size_;
+    Price base_ = 0;
+
+    std::array<Quantity, kWindowTicks> quantities_{};
+    std::array<std::uint64_t, kWords> words_{};
+    std::uint64_t summary_ = 0;
+    std::size_t window_levels_ = 0;
+
+    // Sparse fallback for levels outside the window (ordered best to worst)
+    LevelPool pool_;
+    std::pmr::map<Price, Quantity, Compare> overflow_{&pool_};
+};
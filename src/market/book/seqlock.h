@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "event.h"
+#include "top_view.h"
+
+/*
+Single-writer seqlock publication of a book's top-N view.
+
+The feed thread publishes after every visible change; readers copy without taking the
+book mutex and retry if a publish overlapped their copy. Levels are packed into 64-bit
+atomics (price << 32 | quantity) so the racing copy stays well defined.
+*/
+template <Depth kMaxDepth>
+class SeqLockView {
+public:
+    // Writer only
+    template <class View>
+    void Publish(const View& view) {
+        const std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        version_.store(view.version, std::memory_order_relaxed);
+        Store(bids_, bid_count_, view.bids);
+        Store(asks_, ask_count_, view.asks);
+
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Copies a consistent view into 'out' (reusing its capacity)
+    void Read(BookSnapshot& out) const {
+        while (true) {
+            const std::uint64_t sequence = sequence_.load(std::memory_order_acquire);
+            if (sequence & 1) continue;
+
+            out.version = version_.load(std::memory_order_relaxed);
+            Load(bids_, bid_count_, out.bids);
+            Load(asks_, ask_count_, out.asks);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == sequence) return;
+        }
+    }
+
+private:
+    using Levels = std::array<std::atomic<std::uint64_t>, kMaxDepth>;
+
+    template <class Top>
+    static void Store(Levels& levels, std::atomic<Depth>& count, const Top& side) {
+        Depth i = 0;
+        for (const PriceLevel& level : side) {
+            levels[i++].store(static_cast<std::uint64_t>(level.price) << 32 | level.quantity, std::memory_order_relaxed);
+        }
+        count.store(i, std::memory_order_relaxed);
+    }
+
+    static void Load(const Levels& levels, const std::atomic<Depth>& count, std::vector<PriceLevel>& out) {
+        // A torn count is caught by the sequence check, but must not index past the array
+        const Depth n = std::min(count.load(std::memory_order_relaxed), kMaxDepth);
+        out.resize(n);
+        for (Depth i = 0; i < n; ++i) {
+            const std::uint64_t level = levels[i].load(std::memory_order_relaxed);
+            out[i] = PriceLevel{static_cast<Price>(level >> 32), static_cast<Quantity>(level)};
+        }
+    }
+
+    alignas(64) std::atomic<std::uint64_t> sequence_{0};
+    std::atomic<std::uint64_t> version_{0};
+    std::atomic<Depth> bid_count_{0};
+    std::atomic<Depth> ask_count_{0};
+
+    alignas(64) Levels bids_{};
+    alignas(64) Levels asks_{};
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "event.h"
+#include "level_store.h"
+
+// Effect of one event on a book's visible top-N levels
+struct ViewChange {
+    bool visible = false;                   // the event changed the visible depth
+    Quantity quantity = 0;                  // absolute quantity at the event's price afterwards (0 = deleted)
+    Quantity previous = 0;                  // visible quantity at the event's price before (0 = new level)
+    Quantity stored_previous = 0;           // quantity at the event's price before, in view or not
+    std::optional<PriceLevel> entered;      // level pulled into view by a delete within it
+    std::optional<PriceLevel> left;         // level pushed out of view by an insert within it
+};
+
+/*
+Top 'depth' levels of one side, best first, kept in step with the side's level store.
+
+INVARIANT: levels_[0, count_) are exactly the first min(depth, store.size()) levels of the store.
+*/
+template <Side kSide, Depth kMaxDepth>
+class alignas(64) TopSide {
+public:
+    // 'quantity' is the absolute quantity at 'price' after the event was applied to 'store'
+    template <class Levels>
+    ViewChange Update(Price price, Quantity quantity, Depth depth, const Levels& store) {
+        ViewChange change;
+        change.quantity = quantity;
+
+        PriceLevel* begin = levels_.data();
+        PriceLevel* end = begin + count_;
+        PriceLevel* it = std::lower_bound(begin, end, price, [](const PriceLevel& level, Price p) {
+            return BetterPrice<kSide>{}(level.price, p);
+        });
+
+        if (it != end && it->price == price) {
+            change.visible = true;
+            change.previous = it->quantity;
+
+            if (quantity != 0) {
+                it->quantity = quantity;
+                return change;
+            }
+
+            std::copy(it + 1, end, it);
+            --count_;
+
+            // Refill the tail from the first level beyond the view, if any
+            if (store.size() > count_) {
+                Depth i = 0;
+                store.ForEach([&](Price p, Quantity q) {
+                    if (i++ < count_) return true;
+                    levels_[count_++] = PriceLevel{p, q};
+                    change.entered = PriceLevel{p, q};
+                    return false;
+                });
+            }
+        } else if (quantity != 0 && (it != end || count_ < depth)) {
+            change.visible = true;
+
+            if (count_ == depth) {
+                change.left = levels_[count_ - 1];
+                --end;
+                --count_;
+            }
+
+            std::copy_backward(it, end, end + 1);
+            *it = PriceLevel{price, quantity};
+            ++count_;
+        }
+        return change;
+    }
+
+    const PriceLevel* begin() const { return levels_.data(); }
+
+    const PriceLevel* end() const { return levels_.data() + count_; }
+
+    Depth count() const { return count_; }
+
+private:
+    std::array<PriceLevel, kMaxDepth> levels_{};
+    Depth count_ = 0;
+};
+
+// Copy of a book's visible levels (best first)
+struct BookSnapshot {
+    InstrumentId instrument_id = 0;
+    std::uint64_t version = 0;
+    std::vector<PriceLevel> bids;
+    std::vector<PriceLevel> asks;
+};
+
+// Materialized top-N view of both sides with a version bumped on every visible change
+template <Depth kMaxDepth>
+struct TopOfBook {
+    TopSide<Side::kBid, kMaxDepth> bids;
+    TopSide<Side::kAsk, kMaxDepth> asks;
+    std::uint64_t version = 0;
+};
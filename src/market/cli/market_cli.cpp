@@ -18,11 +18,19 @@ void PrintHelp() {
         << "Options:\n"
         << "  -c, --config   Path to config file\n"
         << "  --cpu          Pin exchange feed thread to specific CPU core (optional)\n"
+        << "                 With FEED_CHANNELS > 1, channel i is pinned to core + i\n"
         << "                 Use -1 to disable pinning (default)\n"
         << "                 Available cores: 0 to " << (std::thread::hardware_concurrency() - 1) << "\n"
         << "  -h, --help     Provide Market Plant CLI information\n";
 }
 
+static BookLayout ParseLayout(const std::string& layout) {
+    if (layout == "tree") return BookLayout::kTree;
+    if (layout == "flat") return BookLayout::kFlat;
+    if (layout == "ladder") return BookLayout::kLadder;
+    throw std::runtime_error("invalid book layout " + layout + " (expected tree, flat or ladder).");
+}
+
 static void ParseConfig(const char* path, MarketPlantCliConfig& out) {
     std::ifstream config(path);
 
@@ -40,9 +48,19 @@ static void ParseConfig(const char* path, MarketPlantCliConfig& out) {
     // instruments
     in.reserve(injson.Size());
     for (const auto& i : injson) {
-        in.push_back(
-            Instrument{static_cast<InstrumentId>(i["instrument_id"].GetUint64()), static_cast<Depth>(i["specifications"]["depth"].GetUint64())}
-        );
+        const auto& spec = i["specifications"];
+        Instrument instrument{static_cast<InstrumentId>(i["instrument_id"].GetUint64()), static_cast<Depth>(spec["depth"].GetUint64())};
+
+        // optional: "layout" ("tree", "flat" or "ladder"), "tick_size", "depth_filter" and "max_orders"
+        if (spec.HasMember("layout")) instrument.layout = ParseLayout(spec["layout"].GetString());
+        if (spec.HasMember("tick_size")) instrument.tick_size = static_cast<Price>(spec["tick_size"].GetUint64());
+        if (spec.HasMember("depth_filter")) instrument.depth_filter = spec["depth_filter"].GetBool();
+        if (spec.HasMember("max_orders")) instrument.max_orders = spec["max_orders"].GetUint();
+
+        if (instrument.tick_size == 0) {
+            throw std::runtime_error("tick_size of instrument id " + std::to_string(instrument.id) + " must be positive.");
+        }
+        in.push_back(instrument);
     }
 }
 
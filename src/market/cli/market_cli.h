@@ -3,12 +3,24 @@
 
 #include "event.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
+// Level storage of an instrument's book (config: "specifications" -> "layout")
+enum class BookLayout : std::uint8_t {
+    kTree = 0,      // "tree"
+    kFlat = 1,      // "flat"
+    kLadder = 2,    // "ladder"
+};
+
 struct Instrument {
     InstrumentId id;
     Depth depth;
+    BookLayout layout = BookLayout::kTree;
+    Price tick_size = 1;
+    bool depth_filter = false;      // publish only changes to the visible depth
+    std::uint32_t max_orders = 0;   // resting orders pooled for order-level (L3) messages (0 = level messages only)
 };
 
 using InstrumentConfig = std::vector<Instrument>;
@@ -15,6 +15,7 @@ using Quantity = std::uint32_t;
 using InstrumentId = std::uint32_t;
 using SubscriberId = std::uint32_t;
 using Timestamp = std::uint64_t;
+using OrderId = std::uint64_t;
 
 enum class Side : std::uint8_t {
   kBid = 0,
@@ -24,8 +25,16 @@ enum class Side : std::uint8_t {
 enum class LevelEvent : std::uint8_t {
   kAddLevel = 0,
   kModifyLevel = 1,
+
+  // Order-level (L3) messages, resolved against the plant's order book into level events
+  kAddOrder = 2,        // new order 'order_id' resting at 'price' for 'quantity'
+  kCancelOrder = 3,     // cancel 'quantity' of 'order_id' (0 or at least its remainder = delete)
+  kExecuteOrder = 4,    // 'quantity' of 'order_id' traded
+  kReplaceOrder = 5,    // delete 'order_id' and rest 'new_order_id' on the same side at 'price' for 'quantity'
 };
 
+inline bool IsOrderEvent(LevelEvent event) { return event >= LevelEvent::kAddOrder; }
+
 /*
 
 Message Payload (Network-Byte-Order / Big Endian)
@@ -38,14 +47,21 @@ offset 28 - 31:     price           (4 bytes, u32)        ex. 'price' = 32 (USD)
 offset 32 - 35:     quantity        (4 bytes, u32)        ex. 'quantity' = 5917
 offset 36 - 43:     exchange_ts     (8 bytes, u64)        ex. 1234567891234567890 (ns)
 
+Order-level messages ('event' >= 2) append:
+
+offset 44 - 51:     order_id        (8 bytes, u64)
+offset 52 - 59:     new_order_id    (8 bytes, u64)        'REPLACE' = 5 only
+
 */
 
 inline constexpr Bytes kSessionLength = 10;
 inline constexpr Bytes kHeaderLength = 20;
 inline constexpr Bytes kMessageCount = 1;
 inline constexpr Bytes kPacketSize = 44;
+inline constexpr Bytes kLevelMessageLength = 22;
+inline constexpr Bytes kOrderMessageLength = kLevelMessageLength + sizeof(OrderId);
+inline constexpr Bytes kReplaceMessageLength = kOrderMessageLength + sizeof(OrderId);
 inline constexpr Bytes kMessageHeaderLength = 2;
-inline constexpr Timestamp kCancellationPollInterval = 500;
 
 inline constexpr MessageCount kEndSession = 0xFFFF;
 inline constexpr MessageCount kMaxMessageCount = kEndSession - 1;
@@ -59,4 +75,6 @@ struct MarketEvent {
     Price price;
     Quantity quantity;
     Timestamp exchange_ts;
+    OrderId order_id = 0;           // order-level messages only
+    OrderId new_order_id = 0;       // kReplaceOrder only
 };
\ No newline at end of file
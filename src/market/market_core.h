@@ -1,75 +1,267 @@
 #pragma once
 
-#include <functional>
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
-#include <unordered_map>
+#include <span>
+#include <unordered_set>
+#include <vector>
 
+#include "broadcast_ring.h"
 #include "event.h"
+#include "level_store.h"
 #include "market_cli.h"
+#include "order_store.h"
+#include "seqlock.h"
+#include "top_view.h"
 
 class Subscriber;
 
+namespace grpc {
+    class ByteBuffer;
+}
+
 namespace market_plant::v1 {
-    class StreamResponse;
     class SnapshotUpdate;
 }
 
 namespace ms = market_plant::v1;
-using StreamResponsePtr = std::shared_ptr<const ms::StreamResponse>;
+
+// A serialized StreamResponse; every stream sending it writes the same ref-counted bytes
+using SerializedResponse = std::shared_ptr<const grpc::ByteBuffer>;
+
+// Instrument ids index a direct lookup table, so they are bounded
+inline constexpr InstrumentId kMaxInstrumentId = (1u << 24) - 1;
+
+// A published level event: the delta applied and the level's quantity before and after it
+struct BookUpdate {
+    MarketEvent event;
+    Quantity level_quantity;
+    Quantity previous_quantity;
+};
+
+// A published level event as the broadcast ring holds it; a batch takes consecutive slots
+struct BookBroadcast {
+    BookUpdate update;
+    bool last;                          // the batch's final event
+};
+
+// Level events one feed event can publish: a replace touches two levels, each of which may move
+// a level into and another out of the visible depth
+inline constexpr std::size_t kMaxUpdatesPerEvent = 6;
+
+// Depth buckets: each book is compiled for the smallest bucket that fits its configured depth
+inline constexpr Depth kDepthBuckets[] = {16, 64, 256};
+inline constexpr Depth kMaxBookDepth = 256;
 
 // All orderbook updates happen from ExchangeFeed
 // All subscription updates happen from the MarketPlantServer
-class OrderBook {
+class alignas(64) OrderBookBase {
 public:
-    OrderBook(InstrumentId id, Depth depth);
+    // 'max_orders' > 0 enables order-level (L3) messages with a pool sized for that many resting orders;
+    // subscribers can lag up to 'broadcast_capacity' published level events behind before they are resynced
+    OrderBookBase(InstrumentId id, Depth depth, bool depth_filter, std::size_t max_orders, std::size_t broadcast_capacity);
+
+    virtual ~OrderBookBase() = default;
+
+    OrderBookBase(const OrderBookBase& other) = delete;
+    OrderBookBase& operator=(const OrderBookBase& other) = delete;
     
     void PushEventToSubscribers(const MarketEvent& data);
 
+    // Applies 'events' (all for this instrument, in order) under one lock and publishes them as one update
+    void ApplyBatch(std::span<const MarketEvent> events);
+
+    // Hands 'subscriber' a snapshot and the broadcast position that continues from it
     void InitializeSubscription(std::shared_ptr<Subscriber> subscriber);
     
     void CancelSubscription(SubscriberId id);
-private:
-    void AddOrder(Side side, Price price, Quantity quantity);
-        
-    void RemoveOrder(Side side, Price price, Quantity quantity);
+
+    // Snapshot of the visible depth; 'cursor' is set to the first broadcast update after it
+    SerializedResponse Resync(std::uint64_t& cursor);
+
+    // Level events published to subscribers, written once and read through per-subscriber cursors
+    const BroadcastRing<BookBroadcast>& broadcast() const { return broadcast_; }
+
+    // Wakes 'subscriber' after the next publish. 'epoch' is the caller's registration token for
+    // this book: a subscriber still registered since the last wake is not added twice
+    void WakeOnPublish(Subscriber& subscriber, std::uint64_t& epoch);
+
+    // Copies the last published top-N levels into 'out' without blocking the feed thread
+    void View(BookSnapshot& out) const;
+
+    InstrumentId id() const { return id_; }
+
+    Depth depth() const { return depth_; }
+
+protected:
+    // Applies 'e' to the levels and the top-N view
+    virtual ViewChange Apply(const MarketEvent& e) = 0;
+
+    // INVARIANT: Caller must hold mutex. Applies a level event and appends what subscribers should see
+    void ApplyLevel(const MarketEvent& e, std::vector<BookUpdate>& published);
+
+    // INVARIANT: Caller must hold mutex
+    virtual void CopyView(BookSnapshot& out) const = 0;
+
+    virtual void ReadView(BookSnapshot& out) const = 0;
 
     void Snapshot(ms::SnapshotUpdate* snapshot);
 
-    template <class Levels>
-    static void UpdateLevel(Levels& levels, Price price, Quantity quantity) {
-        auto [it, added] = levels.try_emplace(price, quantity);
-        if (!added) it->second += quantity;
+    // Events that keep a subscriber's copy of the visible depth exact after 'e'
+    static void ViewEvents(const MarketEvent& e, const ViewChange& change, std::vector<BookUpdate>& out);
+
+    void WakeWaiters();
+
+    std::mutex mutex_;
+    InstrumentId id_;
+    Depth depth_;
+
+    // Suppress events outside the visible depth and publish levels entering / leaving it instead
+    bool depth_filter_;
+
+    // Order-by-order state (nullptr unless configured with 'max_orders')
+    std::unique_ptr<OrderStore> orders_;
+
+    // INVARIANT: Written under mutex
+    BroadcastRing<BookBroadcast> broadcast_;
+
+    // Subscriptions are kept by the control plane under their own lock; the feed thread only reads
+    // whether there are any, so subscription churn never waits on 'mutex_'
+    std::mutex subscriptions_mutex_;
+    std::unordered_set<SubscriberId> subscriptions_;
+    std::atomic<std::uint32_t> subscribers_{0};
+
+    // Parked subscribers to wake on the next publish
+    std::mutex waiters_mutex_;
+    std::vector<std::weak_ptr<Subscriber>> waiters_;
+    std::uint64_t waiters_epoch_ = 1;
+};
+
+/*
+Book specialized at compile time on its level storage (TreeLevels, FlatLevels or PriceLadder)
+and on the maximum depth it may publish. The visible depth is materialized in 'view_' on every
+event, so snapshots copy at most 'depth_' levels per side instead of walking the store, and is
+republished through a seqlock for lock-free readers.
+*/
+template <template <Side> class LevelStore, Depth kMaxDepth>
+class OrderBook final : public OrderBookBase {
+public:
+    OrderBook(InstrumentId id, Depth depth, Price tick_size, bool depth_filter, std::size_t max_orders, std::size_t broadcast_capacity)
+        : OrderBookBase(id, std::min(depth, kMaxDepth), depth_filter, max_orders, broadcast_capacity), bids_(tick_size), asks_(tick_size) {}
+
+private:
+    ViewChange Apply(const MarketEvent& e) override {
+        ViewChange change = e.side == Side::kBid ? ApplySide(bids_, view_.bids, e) : ApplySide(asks_, view_.asks, e);
+        if (change.visible) {
+            ++view_.version;
+            published_.Publish(view_);
+        }
+        return change;
     }
-    
-    template <class Levels>
-    static void ModifyLevel(Levels& levels, typename Levels::iterator it, Quantity quantity) {
-        if (quantity >= it->second) {
-            levels.erase(it);
-        } else {
-            it->second -= quantity;
+
+    template <class Levels, class Top>
+    ViewChange ApplySide(Levels& levels, Top& top, const MarketEvent& e) {
+        // Order-level messages reaching a book without an order store are dropped
+        if (IsOrderEvent(e.event)) [[unlikely]] return ViewChange{};
+
+        std::optional<Quantity> previous;
+        if (e.event == LevelEvent::kAddLevel) {
+            levels.Add(e.price, e.quantity);
+        } else if (!(previous = levels.Reduce(e.price, e.quantity))) [[unlikely]] {
+            return ViewChange{};
         }
+
+        const Quantity quantity = levels.At(e.price);
+        ViewChange change = top.Update(e.price, quantity, depth_, levels);
+        change.stored_previous = previous ? *previous : quantity - e.quantity;
+        return change;
     }
 
-    std::mutex mutex_;
-    std::map<Price, Quantity, std::greater<Price>> bids_;
-    std::map<Price, Quantity, std::less<Price>> asks_;
+    void CopyView(BookSnapshot& out) const override {
+        out.instrument_id = id_;
+        out.version = view_.version;
+        out.bids.assign(view_.bids.begin(), view_.bids.end());
+        out.asks.assign(view_.asks.begin(), view_.asks.end());
+    }
 
-    std::unordered_map<SubscriberId, std::weak_ptr<Subscriber>> subscriptions_;
-    InstrumentId id_;
-    Depth depth_;
+    void ReadView(BookSnapshot& out) const override {
+        published_.Read(out);
+    }
+
+    LevelStore<Side::kBid> bids_;
+    LevelStore<Side::kAsk> asks_;
+    TopOfBook<kMaxDepth> view_;
+    SeqLockView<kMaxDepth> published_;
 };
 
 
+// Sentinel for instrument ids missing from the configuration: events are counted and dropped
+class NullBook final : public OrderBookBase {
+public:
+    NullBook() : OrderBookBase(0, 0, true, 0, 2) {}
+
+    std::uint64_t events() const { return events_.load(std::memory_order_relaxed); }
+
+private:
+    ViewChange Apply(const MarketEvent& e) override {
+        (void)e;
+        events_.fetch_add(1, std::memory_order_relaxed);
+        return ViewChange{};
+    }
+
+    void CopyView(BookSnapshot& out) const override { ReadView(out); }
+
+    void ReadView(BookSnapshot& out) const override {
+        out.version = 0;
+        out.bids.clear();
+        out.asks.clear();
+    }
+
+    std::atomic<std::uint64_t> events_{0};
+};
+
+/*
+Books are remapped at load time from instrument id to a dense index, so a lookup is two array
+reads. Unknown ids (including any id past the table) resolve to the null book instead of throwing.
+*/
 class BookManager {
 public:
-    explicit BookManager(const InstrumentConfig& instruments);
+    // Every book broadcasts to its subscribers through a ring of 'broadcast_capacity' level events
+    BookManager(const InstrumentConfig& instruments, std::size_t broadcast_capacity);
 
-    OrderBook& Book(InstrumentId id);
+    // Book for 'id', or the null book if 'id' is not configured (hot path)
+    OrderBookBase& Book(InstrumentId id) { return *books_[Index(id)]; }
 
-    const OrderBook& Book(InstrumentId id) const;
+    const OrderBookBase& Book(InstrumentId id) const { return *books_[Index(id)]; }
+
+    // nullptr if 'id' is not configured
+    OrderBookBase* Find(InstrumentId id) {
+        const std::uint32_t index = Index(id);
+        return index == kNullIndex ? nullptr : books_[index];
+    }
+
+    // Events received for instrument ids missing from the configuration
+    std::uint64_t unknown_events() const { return null_book_.events(); }
 
 private:
-    std::unordered_map<InstrumentId, OrderBook> books_;
+    static constexpr std::uint32_t kNullIndex = 0;
+
+    std::uint32_t Index(InstrumentId id) const {
+        // The table's last slot is always the null book, so out-of-range ids clamp onto it
+        return index_[std::min<std::size_t>(id, index_.size() - 1)];
+    }
+
+    // Instantiates the book variant selected by the instrument's layout and depth
+    static std::unique_ptr<OrderBookBase> MakeBook(const Instrument& instrument, std::size_t broadcast_capacity);
+
+    NullBook null_book_;
+
+    // index_[instrument id] -> books_ index; books_[kNullIndex] is the null book
+    std::vector<std::uint32_t> index_;
+    std::vector<OrderBookBase*> books_;
+    std::vector<std::unique_ptr<OrderBookBase>> owned_;
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 
@@ -14,6 +16,19 @@ inline int get_env_int(const std::string& key, int default_value) {
     return value ? std::atoi(value) : default_value;
 }
 
+// What a stream does with an instrument whose unread backlog passed 'subscriber_max_backlog'
+enum class OverflowPolicy : std::uint8_t {
+    kResync,        // drop the backlog and send a fresh snapshot
+    kConflate,      // send the backlog's net change per (side, price)
+    kDisconnect,    // end the stream with RESOURCE_EXHAUSTED
+};
+
+inline OverflowPolicy ParseOverflowPolicy(const std::string& name) {
+    if (name == "conflate") return OverflowPolicy::kConflate;
+    if (name == "disconnect") return OverflowPolicy::kDisconnect;
+    return OverflowPolicy::kResync;
+}
+
 struct MarketPlantConfig {
     std::string grpc_host;
     std::uint16_t grpc_port;
@@ -22,6 +37,53 @@ struct MarketPlantConfig {
     std::string exchange_ip;
     std::uint16_t exchange_port;
 
+    // Feed channel i binds 'market_port + i * stride' (or 'market_port' for every channel with SO_REUSEPORT)
+    // and reads from 'exchange_port + i * stride'. FEED_CHANNELS, CHANNEL_PORT_STRIDE and FEED_REUSEPORT
+    // are the same variables the exchange reads
+    std::size_t feed_channels;
+    std::uint16_t channel_port_stride;
+    bool feed_reuseport;
+
+    // A feed channel applies up to 'batch_max_events' events at once, waiting at most 'batch_window_us'
+    // after the first one for more packets (1 event = apply and publish every event on arrival)
+    std::uint32_t batch_window_us;
+    std::size_t batch_max_events;
+
+    // StreamUpdates calls are multiplexed over 'stream_threads' completion-queue threads,
+    // pinned to consecutive cores from 'stream_cpu_core' (-1 = unpinned)
+    std::size_t stream_threads;
+    int stream_cpu_core;
+
+    // Published level events each book keeps for its subscribers to read (rounded up to a power of
+    // two, and to twice the largest batch); a subscriber that falls further behind is resynced from a snapshot
+    std::size_t broadcast_capacity;
+
+    // Subscription changes queued per subscriber; overflowing it ends the stream with RESOURCE_EXHAUSTED
+    std::size_t subscriber_queue_capacity;
+
+    // Concurrent StreamUpdates streams; a stream past it is refused with RESOURCE_EXHAUSTED
+    std::size_t max_subscribers;
+
+    // A subscriber may leave 'subscriber_max_backlog' level events of an instrument unread before the
+    // overflow policy applies, and holds at most 'subscriber_max_bytes' drained but unwritten;
+    // past 'stream_memory_limit' bytes across every stream, every lagging instrument gets the overflow
+    // policy and streams take one response at a time
+    std::uint64_t subscriber_max_backlog;
+    std::size_t subscriber_max_bytes;
+    std::size_t stream_memory_limit;
+    OverflowPolicy overflow_policy;
+
+    // Stream metrics are logged every 'metrics_interval_s' seconds (0 = never)
+    int metrics_interval_s;
+
+    std::uint16_t ExchangePort(std::size_t channel) const {
+        return static_cast<std::uint16_t>(exchange_port + channel * channel_port_stride);
+    }
+
+    std::uint16_t MarketPort(std::size_t channel) const {
+        return feed_reuseport ? market_port : static_cast<std::uint16_t>(market_port + channel * channel_port_stride);
+    }
+
     static MarketPlantConfig New() {
         MarketPlantConfig config;
         
@@ -34,6 +96,25 @@ struct MarketPlantConfig {
         config.exchange_ip = get_env("EXCHANGE_IP", "127.0.0.1");
         config.exchange_port = static_cast<std::uint16_t>(get_env_int("EXCHANGE_PORT", 9000));
 
+        config.feed_channels = static_cast<std::size_t>(std::max(get_env_int("FEED_CHANNELS", 1), 1));
+        config.channel_port_stride = static_cast<std::uint16_t>(get_env_int("CHANNEL_PORT_STRIDE", 2));
+        config.feed_reuseport = get_env_int("FEED_REUSEPORT", 0) != 0;
+
+        config.batch_window_us = static_cast<std::uint32_t>(std::max(get_env_int("BATCH_WINDOW_US", 0), 0));
+        config.batch_max_events = static_cast<std::size_t>(std::max(get_env_int("BATCH_MAX_EVENTS", 1), 1));
+
+        config.stream_threads = static_cast<std::size_t>(std::max(get_env_int("STREAM_THREADS", 2), 1));
+        config.stream_cpu_core = get_env_int("STREAM_CPU_CORE", -1);
+        config.broadcast_capacity = static_cast<std::size_t>(std::max(get_env_int("BROADCAST_CAPACITY", 4096), 2));
+        config.subscriber_queue_capacity = static_cast<std::size_t>(std::max(get_env_int("SUBSCRIBER_QUEUE_CAPACITY", 256), 2));
+        config.max_subscribers = static_cast<std::size_t>(std::max(get_env_int("MAX_SUBSCRIBERS", 65536), 2));
+
+        config.subscriber_max_backlog = static_cast<std::uint64_t>(std::max(get_env_int("SUBSCRIBER_MAX_BACKLOG", 2048), 1));
+        config.subscriber_max_bytes = static_cast<std::size_t>(std::max(get_env_int("SUBSCRIBER_MAX_BYTES", 4 << 20), 1));
+        config.stream_memory_limit = static_cast<std::size_t>(std::max(get_env_int("STREAM_MEMORY_LIMIT_MB", 1024), 1)) << 20;
+        config.overflow_policy = ParseOverflowPolicy(get_env("OVERFLOW_POLICY", "resync"));
+        config.metrics_interval_s = std::max(get_env_int("METRICS_INTERVAL_S", 0), 0);
+
         return config;
     }
     
@@ -5,14 +5,20 @@
 #include "market_cli.h"
 #include "market_plant_config.h"
 
+#include <google/protobuf/arena.h>
+
 #include <arpa/inet.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
 #include <thread>
+#include <utility>
 #include <vector>
 
 std::string SessionGenerator::Generate() {
@@ -25,218 +31,710 @@ std::string SessionGenerator::Generate() {
     return session_key;
 };
 
-OrderBook::OrderBook(InstrumentId id, Depth depth) : id_(id), depth_(depth) {}
+OrderBookBase::OrderBookBase(InstrumentId id, Depth depth, bool depth_filter, std::size_t max_orders, std::size_t broadcast_capacity)
+    : id_(id), depth_(depth), depth_filter_(depth_filter),
+      orders_(max_orders > 0 ? std::make_unique<OrderStore>(max_orders) : nullptr),
+      broadcast_(broadcast_capacity) {}
     
-void OrderBook::PushEventToSubscribers(const MarketEvent& data) {
-    std::vector<std::shared_ptr<Subscriber>> to_enqueue;
+void OrderBookBase::PushEventToSubscribers(const MarketEvent& data) {
+    ApplyBatch(std::span<const MarketEvent>(&data, 1));
+}
+
+void OrderBookBase::ApplyBatch(std::span<const MarketEvent> events) {
+    // Level events to publish for the current batch (reused across batches of the feed thread)
+    thread_local std::vector<BookUpdate> published;
+    published.clear();
 
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        
-        if (data.event == LevelEvent::kAddLevel) { 
-            AddOrder(data.side, data.price, data.quantity);
-        } else { 
-            RemoveOrder(data.side, data.price, data.quantity);
-        }
 
-        to_enqueue.reserve(subscriptions_.size());
-        // Get Subscribers for corresponding InstrumentID
-        for (auto it = subscriptions_.begin(); it != subscriptions_.end(); ) {
-            if (auto sub = it->second.lock()) [[likely]] {
-                to_enqueue.push_back(std::move(sub));
-                ++it;
-            } else {
-                it = subscriptions_.erase(it);
+        for (const MarketEvent& e : events) {
+            if (!IsOrderEvent(e.event) || !orders_) {
+                ApplyLevel(e, published);
+                continue;
             }
+
+            // Order-level messages are published as the level events they imply
+            OrderStore::LevelEvents levels;
+            const std::size_t n = orders_->Apply(e, levels);
+            for (std::size_t i = 0; i < n; ++i) ApplyLevel(levels[i], published);
         }
-    }
+        if (published.empty()) return;
 
-    if (to_enqueue.empty()) return;
+        // A subscriber counted after this load takes its snapshot under this lock once it is
+        // released, so it never reads this batch
+        if (subscribers_.load(std::memory_order_relaxed) == 0) return;
 
-    StreamResponsePtr event = MarketPlantServer::ConstructEventUpdate(data);
-    for (const auto& sub : to_enqueue) sub->Enqueue(event);
+        // Stream threads encode what they read, so the feed thread only copies level events into the ring
+        thread_local std::vector<BookBroadcast> slots;
+        slots.clear();
+        for (const BookUpdate& u : published) slots.push_back(BookBroadcast{u, false});
+        slots.back().last = true;
+
+        // Published under the lock, so a snapshot and the cursor taken with it never straddle a batch
+        broadcast_.Publish(slots);
+    }
+
+    WakeWaiters();
 }
 
-void OrderBook::AddOrder(Side side, Price price, Quantity quantity) {
-    if (side == Side::kBid) {
-        UpdateLevel(bids_, price, quantity);
-    } else {
-        UpdateLevel(asks_, price, quantity);
+void OrderBookBase::ApplyLevel(const MarketEvent& e, std::vector<BookUpdate>& published) {
+    ViewChange change = Apply(e);
+    if (!depth_filter_) {
+        published.push_back(BookUpdate{e, change.quantity, change.stored_previous});
+    } else if (change.visible) {
+        ViewEvents(e, change, published);
     }
 }
 
-void OrderBook::RemoveOrder(Side side, Price price, Quantity quantity) {
-    if (side == Side::kBid) {
-        auto it = bids_.find(price);
-        if (it == bids_.end()) [[unlikely]] return;
-        ModifyLevel(bids_, it, quantity);
-    } else {
-        auto it = asks_.find(price);
-        if (it == asks_.end()) [[unlikely]] return;
-        ModifyLevel(asks_, it, quantity);
+void OrderBookBase::InitializeSubscription(std::shared_ptr<Subscriber> subscriber) {
+    {
+        std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+
+        // Add Subscriber to subscriptions_
+        if (subscriptions_.insert(subscriber->subscriber().subscriber_id).second) {
+            subscribers_.fetch_add(1, std::memory_order_relaxed);
+        }
     }
+
+    // The subscriber reads the broadcast from right after its snapshot
+    std::uint64_t cursor = 0;
+    SerializedResponse snapshot = Resync(cursor);
+    subscriber->StartReading(*this, cursor, std::move(snapshot));
 }
 
-void OrderBook::InitializeSubscription(std::shared_ptr<Subscriber> subscriber) {
-    auto snapshot_response = std::make_shared<ms::StreamResponse>();
-    
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    // Add Subscriber to subscriptions_
-    subscriptions_[subscriber->subscriber().subscriber_id] = subscriber;
-    
-    // Add snapshot to subscriber's queue
+void OrderBookBase::CancelSubscription(SubscriberId id) {
+    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+    if (subscriptions_.erase(id)) subscribers_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+SerializedResponse OrderBookBase::Resync(std::uint64_t& cursor) {
+    ms::StreamResponse* snapshot_response = MarketPlantServer::NewResponse();
     auto* update = snapshot_response->mutable_update();
     update->set_instrument_id(id_);
-    Snapshot(update->mutable_snapshot());
 
-    subscriber->Enqueue(snapshot_response);
-    // This way, any new feed for this instrument is blocked until we get the snapshot in
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Snapshot(update->mutable_snapshot());
+        cursor = broadcast_.next();
+    }
+    return MarketPlantServer::Serialize(*snapshot_response);
 }
 
-void OrderBook::CancelSubscription(SubscriberId id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    subscriptions_.erase(id);
+void OrderBookBase::WakeOnPublish(Subscriber& subscriber, std::uint64_t& epoch) {
+    std::lock_guard<std::mutex> lock(waiters_mutex_);
+    if (epoch == waiters_epoch_) return;
+
+    epoch = waiters_epoch_;
+    waiters_.push_back(subscriber.weak_from_this());
 }
 
-void OrderBook::Snapshot(ms::SnapshotUpdate* snapshot) {
+void OrderBookBase::WakeWaiters() {
+    // Only parked streams are touched: the cost of a publish does not grow with the subscriber count
+    thread_local std::vector<std::weak_ptr<Subscriber>> woken;
+    {
+        std::lock_guard<std::mutex> lock(waiters_mutex_);
+        if (waiters_.empty()) return;
+
+        woken.swap(waiters_);
+        ++waiters_epoch_;
+    }
+
+    for (const auto& waiter : woken) {
+        if (auto sub = waiter.lock()) sub->Wake();
+    }
+    woken.clear();
+}
+
+void OrderBookBase::View(BookSnapshot& out) const {
+    out.instrument_id = id_;
+    ReadView(out);
+}
+
+static void AddSnapshotLevel(ms::SnapshotUpdate* snapshot, Side side, Price price, Quantity quantity) {
+    auto* entry = side == Side::kBid ? snapshot->add_bids() : snapshot->add_asks();
+    entry->set_type(ms::ADD_LEVEL);
+    auto* level = entry->mutable_level();
+    level->set_side(side == Side::kBid ? ms::BID : ms::ASK);
+    level->set_price(price);
+    level->set_quantity(quantity);
+}
+
+static void AddSnapshotLevels(ms::SnapshotUpdate* snapshot, const BookSnapshot& view) {
+    snapshot->mutable_bids()->Reserve(static_cast<int>(view.bids.size()));
+    snapshot->mutable_asks()->Reserve(static_cast<int>(view.asks.size()));
+
+    for (const auto& [price, quantity] : view.bids) AddSnapshotLevel(snapshot, Side::kBid, price, quantity);
+    for (const auto& [price, quantity] : view.asks) AddSnapshotLevel(snapshot, Side::kAsk, price, quantity);
+}
+
+void OrderBookBase::Snapshot(ms::SnapshotUpdate* snapshot) {
     // INVARIANT: Caller must hold mutex
-    snapshot->mutable_bids()->Reserve(static_cast<int>(depth_));
-    snapshot->mutable_asks()->Reserve(static_cast<int>(depth_));
-
-    // Top-Depth Bids
-    auto b_it = bids_.begin();
-    for (Depth i = 0; i < depth_ && b_it != bids_.end(); ++i, ++b_it) {
-        auto* bid = snapshot->add_bids();
-        bid->set_type(ms::ADD_LEVEL);
-        auto* level = bid->mutable_level();
-        level->set_side(ms::BID);
-        level->set_price(b_it->first);
-        level->set_quantity(b_it->second);
-    }
-
-    // Top-Depth Asks
-    auto a_it = asks_.begin();
-    for (Depth i = 0; i < depth_ && a_it != asks_.end(); ++i, ++a_it) {
-        auto* ask = snapshot->add_asks();
-        ask->set_type(ms::ADD_LEVEL);
-        auto* level = ask->mutable_level();
-        level->set_side(ms::ASK);
-        level->set_price(a_it->first);
-        level->set_quantity(a_it->second);
-    }
-}
-
-BookManager::BookManager(const InstrumentConfig& instruments) {
-    books_.reserve(instruments.size());
-    
-    for (const auto& instrument : instruments) {
-        books_.try_emplace(instrument.id, instrument.id, instrument.depth);
+    BookSnapshot view;
+    CopyView(view);
+    AddSnapshotLevels(snapshot, view);
+}
+
+void OrderBookBase::ViewEvents(const MarketEvent& e, const ViewChange& change, std::vector<BookUpdate>& out) {
+    // A level leaving view is removed first, so subscribers never hold more than the visible depth
+    if (change.left) {
+        out.push_back(BookUpdate{MarketEvent{e.instrument_id, e.side, LevelEvent::kModifyLevel, change.left->price, change.left->quantity, e.exchange_ts}, 0, change.left->quantity});
+    }
+
+    // The applied change, as seen by the view (a reduce never exceeds the visible quantity)
+    MarketEvent visible = e;
+    if (e.event == LevelEvent::kModifyLevel) visible.quantity = change.previous - change.quantity;
+    out.push_back(BookUpdate{visible, change.quantity, change.previous});
+
+    if (change.entered) {
+        out.push_back(BookUpdate{MarketEvent{e.instrument_id, e.side, LevelEvent::kAddLevel, change.entered->price, change.entered->quantity, e.exchange_ts}, change.entered->quantity, 0});
     }
 }
 
-OrderBook& BookManager::Book(InstrumentId id) {
-    auto it = books_.find(id);
-    if (it == books_.end()) {
-        throw std::runtime_error("Error: unknown instrument id " + std::to_string(id));
+template <template <Side> class LevelStore>
+static std::unique_ptr<OrderBookBase> MakeBookWithLayout(const Instrument& instrument, std::size_t broadcast_capacity) {
+    if (instrument.depth <= kDepthBuckets[0]) {
+        return std::make_unique<OrderBook<LevelStore, kDepthBuckets[0]>>(instrument.id, instrument.depth, instrument.tick_size, instrument.depth_filter, instrument.max_orders, broadcast_capacity);
+    } else if (instrument.depth <= kDepthBuckets[1]) {
+        return std::make_unique<OrderBook<LevelStore, kDepthBuckets[1]>>(instrument.id, instrument.depth, instrument.tick_size, instrument.depth_filter, instrument.max_orders, broadcast_capacity);
     }
-    return it->second;
+    return std::make_unique<OrderBook<LevelStore, kDepthBuckets[2]>>(instrument.id, instrument.depth, instrument.tick_size, instrument.depth_filter, instrument.max_orders, broadcast_capacity);
 }
 
-const OrderBook& BookManager::Book(InstrumentId id) const {
-    auto it = books_.find(id);
-    if (it == books_.end()) {
-        throw std::runtime_error("Error: unknown instrument id " + std::to_string(id));
+BookManager::BookManager(const InstrumentConfig& instruments, std::size_t broadcast_capacity) {
+    InstrumentId max_id = 0;
+    for (const auto& instrument : instruments) {
+        if (instrument.id > kMaxInstrumentId) {
+            throw std::runtime_error("Error: instrument id " + std::to_string(instrument.id) + " exceeds " + std::to_string(kMaxInstrumentId));
+        }
+        max_id = std::max(max_id, instrument.id);
+    }
+
+    // One slot past the largest id stays on the null book for out-of-range lookups
+    index_.assign(static_cast<std::size_t>(max_id) + 2, kNullIndex);
+    books_.reserve(instruments.size() + 1);
+    owned_.reserve(instruments.size());
+    books_.push_back(&null_book_);
+
+    for (const auto& instrument : instruments) {
+        if (index_[instrument.id] != kNullIndex) continue;
+
+        owned_.push_back(MakeBook(instrument, broadcast_capacity));
+        index_[instrument.id] = static_cast<std::uint32_t>(books_.size());
+        books_.push_back(owned_.back().get());
     }
-    return it->second;
 }
 
+std::unique_ptr<OrderBookBase> BookManager::MakeBook(const Instrument& instrument, std::size_t broadcast_capacity) {
+    if (instrument.depth > kMaxBookDepth) {
+        throw std::runtime_error("Error: depth of instrument id " + std::to_string(instrument.id) + " exceeds " + std::to_string(kMaxBookDepth));
+    }
 
-Subscriber::Subscriber(const Identifier& subscriber, const ms::InstrumentIds& instruments)
-    : subscriber_(subscriber) {
+    switch (instrument.layout) {
+        case BookLayout::kFlat: return MakeBookWithLayout<FlatLevels>(instrument, broadcast_capacity);
+        case BookLayout::kLadder: return MakeBookWithLayout<PriceLadder>(instrument, broadcast_capacity);
+        case BookLayout::kTree:
+        default: return MakeBookWithLayout<TreeLevels>(instrument, broadcast_capacity);
+    }
+}
+
+Subscriber::Subscriber(const Identifier& subscriber, const ms::InstrumentIds& instruments, const ms::SubscriptionOptions& options,
+                       const StreamLimits& limits, StreamMetrics& metrics)
+    : subscriber_(subscriber), absolute_quantity_(options.absolute_quantity()), conflate_backlog_(options.conflate_backlog()),
+      limits_(limits), metrics_(metrics), changes_(limits.queue_capacity) {
+    // Filled by Subscribe once the books are registered with
     subscribed_to_.reserve(static_cast<size_t>(instruments.ids_size()));
+}
 
-    for (auto x : instruments.ids()) {
-        subscribed_to_.insert(static_cast<InstrumentId>(x));
-    }
+Subscriber::~Subscriber() {
+    metrics_.queued_bytes.fetch_sub(static_cast<std::int64_t>(round_bytes_), std::memory_order_relaxed);
 }
 
-bool Subscriber::Subscribe(InstrumentId id) {
-    // If not in unordered_set, Add to unordered_set
+bool Subscriber::Subscribe(OrderBookBase& book) {
+    // Held until the snapshot is queued: an Unsubscribe of the same instrument lands wholly before or after
     std::lock_guard<std::mutex> lock(mutex_);
-    if (subscribed_to_.find(id) == subscribed_to_.end()) {
-        subscribed_to_.insert(id);
-        return true;
-    }
-    return false;
+    if (closed_ || !subscribed_to_.insert(book.id()).second) return false;
+
+    subscriptions_.store(subscribed_to_.size(), std::memory_order_release);
+    book.InitializeSubscription(shared_from_this());
+    return true;
 }
 
-void Subscriber::Unsubscribe(InstrumentId id) {
-    // If in unordered_set, remove from unordered_set.
+void Subscriber::Unsubscribe(OrderBookBase& book) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (subscribed_to_.find(id) != subscribed_to_.end()) {
-        subscribed_to_.erase(id);
+    if (subscribed_to_.erase(book.id())) {
+        book.CancelSubscription(subscriber_.subscriber_id);
+        if (!changes_.TryPush(CursorChange{nullptr, book.id(), 0, nullptr})) [[unlikely]] overrun_.store(true, std::memory_order_release);
     }
-    if (subscribed_to_.empty()) cv_.notify_one();
+    subscriptions_.store(subscribed_to_.size(), std::memory_order_release);
+    Wake();
 }
 
-void Subscriber::Enqueue(const StreamResponsePtr& next) {
+std::vector<InstrumentId> Subscriber::Close() {
     std::lock_guard<std::mutex> lock(mutex_);
-    updates_.push_back(next);
-    // If the queue was previously empty, signal the CV
-    if (updates_.size() == 1) cv_.notify_one();
+    closed_ = true;
+    return std::vector<InstrumentId>(subscribed_to_.begin(), subscribed_to_.end());
+}
+
+void Subscriber::StartReading(OrderBookBase& book, std::uint64_t cursor, SerializedResponse snapshot) {
+    if (!changes_.TryPush(CursorChange{&book, book.id(), cursor, std::move(snapshot)})) [[unlikely]] {
+        overrun_.store(true, std::memory_order_release);
+    }
+    Wake();
+}
+
+Subscriber::DequeueResult Subscriber::Drain(std::vector<SerializedResponse>& out) {
+    // The previous round was written out: its bytes no longer count
+    metrics_.queued_bytes.fetch_sub(static_cast<std::int64_t>(std::exchange(round_bytes_, 0)), std::memory_order_relaxed);
+
+    while (true) {
+        if (overrun_.load(std::memory_order_acquire)) [[unlikely]] return DequeueResult::kOverrun;
+        if (subscriptions_.load(std::memory_order_acquire) == 0) return DequeueResult::kClosed;
+
+        // Subscription changes first: a book's snapshot must precede what is read after it
+        CursorChange change;
+        while (changes_.TryPop(change)) Apply(change, out);
+
+        // A throttled round leaves the rest in the rings; the next one starts at the following book
+        const std::size_t n = cursors_.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!ReadBook(cursors_[(first_cursor_ + i) % n], out)) {
+                first_cursor_ = (first_cursor_ + i + 1) % n;
+                break;
+            }
+        }
+
+        if (overrun_.load(std::memory_order_acquire)) [[unlikely]] return DequeueResult::kOverrun;
+        if (!out.empty()) return DequeueResult::kUpdates;
+
+        // Park, then look again: a publish racing the arming may not have seen it
+        armed_.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (Exhausted()) return DequeueResult::kEmpty;
+
+        // A publisher already claimed the wake: it will be delivered, so stay parked until then
+        if (!armed_.exchange(false, std::memory_order_acq_rel)) return DequeueResult::kEmpty;
+    }
+}
+
+void Subscriber::Apply(CursorChange& change, std::vector<SerializedResponse>& out) {
+    auto it = std::find_if(cursors_.begin(), cursors_.end(), [&](const Cursor& c) { return c.book->id() == change.instrument_id; });
+
+    if (!change.book) {
+        if (it != cursors_.end()) cursors_.erase(it);
+        return;
+    }
+
+    Take(std::move(change.snapshot), out);
+    if (it != cursors_.end()) {
+        it->next = change.cursor;
+    } else {
+        cursors_.push_back(Cursor{change.book, change.cursor});
+    }
+}
+
+// Batches are encoded by the stream threads that send them. Streams sharing a thread share the
+// bytes too, so a batch is serialized at most once per stream thread and representation
+static SerializedResponse EncodeBatch(const OrderBookBase& book, std::uint64_t sequence, bool absolute, std::span<const BookUpdate> updates) {
+    struct Encoded {
+        const OrderBookBase* book = nullptr;
+        std::uint64_t sequence = 0;
+        bool absolute = false;
+        SerializedResponse response;
+    };
+    constexpr std::size_t kEntries = 1024;
+    thread_local std::array<Encoded, kEntries> encoded;
+
+    const std::uint64_t key = static_cast<std::uint64_t>(book.id()) * 0x9E3779B97F4A7C15ull + sequence * 2 + absolute;
+    Encoded& entry = encoded[key & (kEntries - 1)];
+    if (entry.response && entry.book == &book && entry.sequence == sequence && entry.absolute == absolute) return entry.response;
+
+    entry = Encoded{&book, sequence, absolute, updates.size() == 1
+        ? MarketPlantServer::ConstructEventUpdate(updates.front(), absolute)
+        : MarketPlantServer::ConstructBatchUpdate(book.id(), updates, absolute)};
+    return entry.response;
+}
+
+bool Subscriber::ReadBook(Cursor& cursor, std::vector<SerializedResponse>& out) {
+    using ReadResult = BroadcastRing<BookBroadcast>::ReadResult;
+
+    // A backlog past the subscriber's threshold goes out as its net effect instead of update by update;
+    // one past the server's bound, or any backlog while every stream together is over the memory
+    // ceiling, gets the overflow policy
+    // Both are taken whole, so a throttled round leaves the backlog in the ring for the next one
+    if (Throttled(out)) return false;
+
+    const std::uint64_t backlog = cursor.book->broadcast().next() - cursor.next;
+    if (conflate_backlog_ > 0 && backlog > conflate_backlog_) {
+        Conflate(cursor, out);
+    } else if (backlog > limits_.max_backlog || (backlog > 1 && OverCeiling())) [[unlikely]] {
+        Overflow(cursor, out);
+        if (overrun_.load(std::memory_order_relaxed)) return false;
+    }
+
+    BookBroadcast slot;
+    while (true) {
+        if (Throttled(out)) return false;
+
+        // A batch takes consecutive slots and is published whole, so it is read whole too
+        batch_.clear();
+        const std::uint64_t first = cursor.next;
+        std::uint64_t sequence = first;
+        ReadResult result;
+        do {
+            result = cursor.book->broadcast().Read(sequence++, slot);
+            if (result != ReadResult::kReady) break;
+            batch_.push_back(slot.update);
+        } while (!slot.last);
+
+        if (result == ReadResult::kPending) return true;
+
+        if (result == ReadResult::kOverrun) [[unlikely]] {
+            // Lapped by the writer: start over from a fresh snapshot
+            metrics_.lapped.fetch_add(1, std::memory_order_relaxed);
+            Take(cursor.book->Resync(cursor.next), out);
+            continue;
+        }
+
+        Take(EncodeBatch(*cursor.book, first, absolute_quantity_, batch_), out);
+        cursor.next = sequence;
+    }
+}
+
+void Subscriber::Overflow(Cursor& cursor, std::vector<SerializedResponse>& out) {
+    switch (limits_.policy) {
+        case OverflowPolicy::kResync:
+            // Drop the backlog: the snapshot stands in for all of it
+            metrics_.overflow_resyncs.fetch_add(1, std::memory_order_relaxed);
+            Take(cursor.book->Resync(cursor.next), out);
+            break;
+
+        case OverflowPolicy::kConflate:
+            metrics_.overflow_conflations.fetch_add(1, std::memory_order_relaxed);
+            Conflate(cursor, out);
+            break;
+
+        case OverflowPolicy::kDisconnect:
+            metrics_.overflow_disconnects.fetch_add(1, std::memory_order_relaxed);
+            overrun_.store(true, std::memory_order_release);
+            break;
+    }
+}
+
+void Subscriber::Take(SerializedResponse response, std::vector<SerializedResponse>& out) {
+    const std::size_t bytes = response->Length();
+    round_bytes_ += bytes;
+    metrics_.queued_bytes.fetch_add(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+    out.push_back(std::move(response));
+}
+
+bool Subscriber::Throttled(const std::vector<SerializedResponse>& out) {
+    // Always take something, so a stream makes progress however full the server is
+    if (out.empty()) return false;
+
+    if (!OverCeiling() && round_bytes_ < limits_.max_bytes) return false;
+
+    metrics_.throttled.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool Subscriber::OverCeiling() {
+    const std::int64_t queued = metrics_.queued_bytes.load(std::memory_order_relaxed);
+    const std::int64_t ceiling = static_cast<std::int64_t>(limits_.memory_ceiling);
+    const bool over = queued >= ceiling;
+
+    // Logged once per crossing, by the stream that notices it; clearing waits until 3/4 of the
+    // ceiling so a server hovering at the limit does not log on every drain
+    const bool was_over = metrics_.over_ceiling.load(std::memory_order_relaxed);
+    if (over && !was_over && !metrics_.over_ceiling.exchange(true, std::memory_order_relaxed)) {
+        metrics_.ceiling_crossings.fetch_add(1, std::memory_order_relaxed);
+        std::cerr << "Stream memory ceiling reached by subscriber " << subscriber_.subscriber_id << " (" << queued
+                  << " bytes queued): lagging instruments get the overflow policy\n";
+    } else if (was_over && queued < ceiling / 4 * 3 && metrics_.over_ceiling.exchange(false, std::memory_order_relaxed)) {
+        std::cerr << "Stream memory back under the ceiling (" << queued << " bytes queued)\n";
+    }
+    return over;
 }
 
-StreamResponsePtr Subscriber::WaitDequeue(ServerContext* ctx) {
-    std::unique_lock<std::mutex> lock(mutex_);
+void Subscriber::Conflate(Cursor& cursor, std::vector<SerializedResponse>& out) {
+    conflated_index_.clear();
+    conflated_.clear();
 
-    // If:
-        // No Market Updates
-        // Subscriber is still connected
-        // Subscriber is subscribed to  >= 1 instrument
-        // 
-    // -> Go to sleep
+    BookBroadcast slot;
+    std::uint32_t merged = 0;
+    const std::uint64_t end = cursor.book->broadcast().next();
 
-    while (updates_.empty() && !(ctx && ctx->IsCancelled()) && !subscribed_to_.empty()) {
-        cv_.wait_for(lock, std::chrono::milliseconds(kCancellationPollInterval)); 
+    for (; cursor.next < end; ++cursor.next) {
+        // Lapped part-way: the merged state is dropped and the regular read resyncs instead
+        if (cursor.book->broadcast().Read(cursor.next, slot) != BroadcastRing<BookBroadcast>::ReadResult::kReady) [[unlikely]] {
+            return;
+        }
+
+        const BookUpdate& u = slot.update;
+        const std::uint64_t key = static_cast<std::uint64_t>(u.event.side) << 32 | u.event.price;
+        auto [it, added] = conflated_index_.try_emplace(key, conflated_.size());
+        if (added) conflated_.push_back(ConflatedLevel{u, u.previous_quantity});
+        conflated_[it->second].latest = u;
+        if (slot.last) ++merged;
     }
 
-    if ((ctx && ctx->IsCancelled()) || subscribed_to_.empty()) return nullptr;
+    // Each level moves from its quantity before the backlog to its quantity after it: absolute
+    // subscribers get the final quantity, delta subscribers the difference
+    merged_.clear();
+    for (const ConflatedLevel& level : conflated_) {
+        BookUpdate u = level.latest;
+        const Quantity before = level.previous_quantity;
+        const Quantity after = u.level_quantity;
+        if (before == after) continue;
+
+        if (!absolute_quantity_) {
+            u.event.event = after > before ? LevelEvent::kAddLevel : LevelEvent::kModifyLevel;
+            u.event.quantity = after > before ? after - before : before - after;
+        }
+        u.previous_quantity = before;
+        merged_.push_back(u);
+    }
+
+    metrics_.conflations.fetch_add(1, std::memory_order_relaxed);
+    metrics_.conflated_updates.fetch_add(merged, std::memory_order_relaxed);
+    Take(MarketPlantServer::ConstructBatchUpdate(cursor.book->id(), merged_, absolute_quantity_, merged), out);
+}
+
+bool Subscriber::Exhausted() {
+    for (Cursor& cursor : cursors_) cursor.book->WakeOnPublish(*this, cursor.wake_epoch);
 
-    // queue is non-empty: pop + return one item.
-    auto next = std::move(updates_.front());
-    updates_.pop_front();
-    return next;
+    if (!changes_.empty() || overrun_.load(std::memory_order_acquire) || subscriptions_.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    for (const Cursor& cursor : cursors_) {
+        if (cursor.book->broadcast().next() != cursor.next) return false;
+    }
+    return true;
 }
 
+void Subscriber::SetWaker(std::function<void()> wake) {
+    wake_ = std::move(wake);
+}
 
+bool Subscriber::Disarm() {
+    return armed_.exchange(false, std::memory_order_acq_rel);
+}
 
-MarketPlantServer::MarketPlantServer(BookManager& books) : books_(books) {}
+void Subscriber::Wake() {
+    // Pairs with the fence in Drain: either the publisher sees the arming or the stream sees the update
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (armed_.load(std::memory_order_relaxed) && armed_.exchange(false, std::memory_order_acq_rel)) wake_();
+}
+
+std::string StreamMetrics::Report() const {
+    return "streams=" + std::to_string(streams.load(std::memory_order_relaxed))
+        + " queued_bytes=" + std::to_string(queued_bytes.load(std::memory_order_relaxed))
+        + " throttled=" + std::to_string(throttled.load(std::memory_order_relaxed))
+        + " lapped=" + std::to_string(lapped.load(std::memory_order_relaxed))
+        + " overflow_resyncs=" + std::to_string(overflow_resyncs.load(std::memory_order_relaxed))
+        + " overflow_conflations=" + std::to_string(overflow_conflations.load(std::memory_order_relaxed))
+        + " overflow_disconnects=" + std::to_string(overflow_disconnects.load(std::memory_order_relaxed))
+        + " ceiling_crossings=" + std::to_string(ceiling_crossings.load(std::memory_order_relaxed))
+        + " conflations=" + std::to_string(conflations.load(std::memory_order_relaxed))
+        + " conflated_updates=" + std::to_string(conflated_updates.load(std::memory_order_relaxed));
+}
 
-Status MarketPlantServer::StreamUpdates(ServerContext* context, const ms::Subscription* request, ServerWriter< ms::StreamResponse>* writer) {
+MarketPlantServer::MarketPlantServer(BookManager& books, const StreamLimits& limits, std::size_t max_subscribers)
+    : books_(books), limits_(limits), subscribers_(max_subscribers) {}
+
+StreamCall::StreamCall(MarketPlantServer& server, grpc::ServerCompletionQueue* cq)
+    : server_(server), cq_(cq) {
+    ctx_.AsyncNotifyWhenDone(&done_tag_);
+    server_.RequestStreamUpdates(&ctx_, &request_buffer_, &writer_, cq_, cq_, &new_call_tag_);
+}
+
+void StreamCall::Proceed(void* tag, bool ok) {
+    Tag* t = static_cast<Tag*>(tag);
+    t->call->Handle(t->event, ok);
+}
+
+void StreamCall::Handle(Event event, bool ok) {
+    switch (event) {
+        case Event::kNewCall:
+            // Queue shutting down: the call never started, so no other tag will return
+            if (!ok) {
+                delete this;
+                return;
+            }
+            new StreamCall(server_, cq_);   // keep accepting streams on this queue
+            ++pending_;                     // done tag
+            Start();
+            break;
+
+        case Event::kWrite:
+            --pending_;
+            if (ok) {
+                WriteNext();
+            } else {
+                closing_ = true;
+            }
+            break;
+
+        case Event::kWake:
+            --pending_;
+            parked_ = false;
+            WriteNext();
+            break;
+
+        case Event::kFinish:
+            --pending_;
+            break;
+
+        case Event::kDone:
+            --pending_;
+            done_ = true;
+            closing_ = true;
+
+            // A parked stream is released here unless a wake is already on its way
+            if (parked_ && subscriber_->Disarm()) {
+                parked_ = false;
+                --pending_;
+            }
+            break;
+    }
+
+    if (done_ && pending_ == 0) {
+        if (subscriber_) {
+            server_.RemoveSubscriber(*subscriber_);
+        }
+        delete this;
+    }
+}
+
+void StreamCall::Start() {
     // NOTE: on first call, it is a new subscribe
-    if (!request || !request->has_subscribe()) {
-        return Status(grpc::StatusCode::INVALID_ARGUMENT, "Error: invalid request.");
+    const bool parsed = grpc::SerializationTraits<ms::Subscription>::Deserialize(&request_buffer_, &request_).ok();
+    if (!parsed || !request_.has_subscribe()) {
+        Finish(Status(grpc::StatusCode::INVALID_ARGUMENT, "Error: invalid request."));
+        return;
     }
 
-    std::shared_ptr<Subscriber> subscriber = this->AddSubscriber(request->subscribe());
-    const auto& [id, session_key] = subscriber->subscriber();
+    for (auto instrument_id : request_.subscribe().ids()) {
+        if (!server_.books_.Find(instrument_id)) {
+            Finish(MarketPlantServer::UnknownInstrument(instrument_id));
+            return;
+        }
+    }
+
+    coalesce_ = request_.options().batch_updates();
+    subscriber_ = server_.AddSubscriber(request_.subscribe(), request_.options());
+    if (!subscriber_) {
+        Finish(Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Error: too many subscribers."));
+        return;
+    }
+    subscriber_->SetWaker([this] { alarm_.Set(cq_, std::chrono::system_clock::now(), &wake_tag_); });
+    const auto& [id, session_key] = subscriber_->subscriber();
 
     // Send session_key and subscriber_id first
     ms::StreamResponse init_response;
     auto* init = init_response.mutable_init();
     init->set_subscriber_id(id);
     init->set_session_id(session_key.data(), session_key.size());
-    writer->Write(init_response);
 
-    while (true) {
-        auto update = subscriber->WaitDequeue(context);
-        if (!update) break;
-        if (!writer->Write(*update)) break;
+    init_ = MarketPlantServer::Serialize(init_response);
+    writer_.Write(*init_, &write_tag_);
+    ++pending_;
+}
+
+void StreamCall::WriteNext() {
+    if (closing_) return;
+
+    if (next_ == batch_.size()) {
+        batch_.clear();
+        next_ = 0;
+
+        switch (subscriber_->Drain(batch_)) {
+            case Subscriber::DequeueResult::kUpdates:
+                break;
+            case Subscriber::DequeueResult::kEmpty:
+                parked_ = true;
+                ++pending_;
+                return;
+            case Subscriber::DequeueResult::kClosed:
+                Finish(Status::OK);
+                return;
+            case Subscriber::DequeueResult::kOverrun:
+                Finish(Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Error: subscriber fell behind the feed; resubscribe."));
+                return;
+        }
     }
-    
-    RemoveSubscriber(id);
-    return Status::OK;
+
+    if (coalesce_) {
+        WriteCoalesced();
+        return;
+    }
+
+    // Hint gRPC to hold a write back while the rest of the burst follows, so it leaves in few frames
+    grpc::WriteOptions options;
+    if (next_ + 1 < batch_.size()) options.set_buffer_hint();
+
+    writer_.Write(*batch_[next_++], options, &write_tag_);
+    ++pending_;
+}
+
+void StreamCall::WriteCoalesced() {
+    // Drained responses are encoded StreamResponse{update}, and UpdateBatch.updates shares the field
+    // number: their bytes are UpdateBatch elements as they are, so the slices are shared, not re-encoded
+    static_assert(static_cast<int>(ms::UpdateBatch::kUpdatesFieldNumber) == static_cast<int>(ms::StreamResponse::kUpdateFieldNumber));
+
+    slices_.resize(1);      // header, filled in below
+    std::size_t length = 0;
+    const std::size_t first = next_;
+
+    while (next_ < batch_.size() && (next_ == first || length + batch_[next_]->Length() <= kMaxCoalescedBytes)) {
+        length += batch_[next_]->Length();
+        batch_[next_]->Dump(&dumped_);
+        slices_.insert(slices_.end(), dumped_.begin(), dumped_.end());
+        ++next_;
+    }
+
+    grpc::WriteOptions options;
+    if (next_ < batch_.size()) options.set_buffer_hint();
+
+    // A lone update goes out as it is
+    if (next_ - first == 1) {
+        writer_.Write(*batch_[first], options, &write_tag_);
+        ++pending_;
+        return;
+    }
+
+    using google::protobuf::io::CodedOutputStream;
+    std::uint8_t header[16];
+    std::uint8_t* end = CodedOutputStream::WriteTagToArray(ms::StreamResponse::kBatchFieldNumber << 3 | 2, header);
+    end = CodedOutputStream::WriteVarint32ToArray(static_cast<std::uint32_t>(length), end);
+    slices_[0] = grpc::Slice(header, static_cast<std::size_t>(end - header));
+
+    coalesced_ = grpc::ByteBuffer(slices_.data(), slices_.size());
+    writer_.Write(coalesced_, options, &write_tag_);
+    ++pending_;
+}
+
+void StreamCall::Finish(const Status& status) {
+    closing_ = true;
+    writer_.Finish(status, &finish_tag_);
+    ++pending_;
+}
+
+void MarketPlantServer::DriveStreams(grpc::ServerCompletionQueue* cq, int cpu_core) {
+    if (cpu_core >= 0) {
+        if (CPUAffinity::PinToCore(cpu_core)) [[likely]]
+            std::cout << "Successfully pinned stream thread to core " << cpu_core << ".\n";
+        else {
+            std::cout << "Failed to pin stream thread to core " << cpu_core << ".\n";
+        }
+    }
+
+    new StreamCall(*this, cq);
+
+    void* tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) StreamCall::Proceed(tag, ok);
 }
 
 Status MarketPlantServer::UpdateSubscriptions(ServerContext* context, const ms::UpdateSubscriptionRequest* request, ::google::protobuf::Empty* response) {
@@ -247,23 +745,9 @@ Status MarketPlantServer::UpdateSubscriptions(ServerContext* context, const ms::
     const std::string& session_id = request->session_id();
 
     // reject if subscription id and token doesn't match
-    std::shared_ptr<Subscriber> subscriber;
-    {
-        std::shared_lock<std::shared_mutex> lock(sub_lock_);
-        auto it = subscribers_.find(subscriber_id);
-        if (it == subscribers_.end()) {
-            return Status(grpc::StatusCode::NOT_FOUND, "Error: unknown subscriber_id.");
-        }
-        subscriber = it->second.lock();
-    }
-
+    std::shared_ptr<Subscriber> subscriber = subscribers_.Find(subscriber_id);
     if (!subscriber) {
-        std::unique_lock<std::shared_mutex> lock(sub_lock_);
-        auto it = subscribers_.find(subscriber_id);
-        if (it != subscribers_.end() && it->second.expired()) {
-            subscribers_.erase(it);
-        }
-        return Status(grpc::StatusCode::NOT_FOUND, "Error: subscriber expired.");
+        return Status(grpc::StatusCode::NOT_FOUND, "Error: unknown subscriber_id.");
     } else if (subscriber->subscriber().session_key != session_id) {
         return Status(grpc::StatusCode::PERMISSION_DENIED, "Error: invalid session_id.");
     }
@@ -274,71 +758,139 @@ Status MarketPlantServer::UpdateSubscriptions(ServerContext* context, const ms::
         const ms::InstrumentIds& ids = change.subscribe();
 
         for (auto instrument_id : ids.ids()) {
-            OrderBook* book = nullptr;
             // filter for valid instruments
-            try {
-                book = &books_.Book(instrument_id);
-            } catch (const std::exception& e) {
-                return Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
-            }
+            OrderBookBase* book = books_.Find(instrument_id);
+            if (!book) return UnknownInstrument(instrument_id);
 
             // Only initialize subscription and queue snapshot if new subscription
-            if (subscriber->Subscribe(instrument_id)) book->InitializeSubscription(subscriber);
+            subscriber->Subscribe(*book);
         }
     } else if (change.has_unsubscribe()) {
         const ms::InstrumentIds& ids = change.unsubscribe();
         for (auto instrument_id : ids.ids()) {
             // Filter for valid instruments
-            try {
-                books_.Book(instrument_id).CancelSubscription(subscriber_id);
-            } catch (const std::exception& e) {
-                return Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
-            }
+            OrderBookBase* book = books_.Find(instrument_id);
+            if (!book) return UnknownInstrument(instrument_id);
 
-            subscriber->Unsubscribe(instrument_id);
+            subscriber->Unsubscribe(*book);
         }
     }
     return Status::OK;
 }
 
-std::shared_ptr<Subscriber> MarketPlantServer::AddSubscriber(const ms::InstrumentIds& subscriptions) {
-    std::shared_ptr<Subscriber> sub;
+Status MarketPlantServer::GetSnapshot(ServerContext* context, const ms::InstrumentIds* request, ms::SnapshotResponse* response) {
+    (void)context;
+
+    // Each book is read consistently on its own; versions tell clients whether a book moved
+    BookSnapshot view;
+    response->mutable_snapshots()->Reserve(request->ids_size());
 
-    // add new id to subscribers_
-    Identifier subscriber = InitSubscriber();
-    sub = std::make_shared<Subscriber>(subscriber, subscriptions);
-    {
-        std::unique_lock<std::shared_mutex> lock(sub_lock_);
-        subscribers_[subscriber.subscriber_id] = sub;
+    for (auto instrument_id : request->ids()) {
+        const OrderBookBase* book = books_.Find(instrument_id);
+        if (!book) return UnknownInstrument(instrument_id);
+
+        book->View(view);
+
+        auto* snapshot = response->add_snapshots();
+        snapshot->set_instrument_id(instrument_id);
+        snapshot->set_version(view.version);
+        AddSnapshotLevels(snapshot->mutable_snapshot(), view);
     }
+    return Status::OK;
+}
+
+std::shared_ptr<Subscriber> MarketPlantServer::AddSubscriber(const ms::InstrumentIds& subscriptions, const ms::SubscriptionOptions& options) {
+    // The registry slot's handle is the new subscriber's id
+    std::shared_ptr<Subscriber> sub = subscribers_.Emplace([&](SubscriberId id) {
+        return std::make_shared<Subscriber>(InitSubscriber(id), subscriptions, options, limits_, metrics_);
+    });
+    if (!sub) return nullptr;
+    metrics_.streams.fetch_add(1, std::memory_order_relaxed);
 
     // Initialize Subscriptions
     for (auto& id : subscriptions.ids()) {
-        OrderBook& book = books_.Book(id);
-        book.InitializeSubscription(sub);
+        sub->Subscribe(books_.Book(id));
     }
 
     return sub;
 }
 
-void MarketPlantServer::RemoveSubscriber(const SubscriberId id) {
-    std::unique_lock<std::shared_mutex> lock(sub_lock_);
-    subscribers_.erase(id);
+void MarketPlantServer::RemoveSubscriber(Subscriber& subscriber) {
+    const SubscriberId id = subscriber.subscriber().subscriber_id;
+    // Closed first, so a racing UpdateSubscriptions cannot register with a book after this sweep
+    for (InstrumentId instrument_id : subscriber.Close()) {
+        if (OrderBookBase* book = books_.Find(instrument_id)) book->CancelSubscription(id);
+    }
+
+    metrics_.streams.fetch_sub(1, std::memory_order_relaxed);
+    subscribers_.Erase(id);
 }
 
-StreamResponsePtr MarketPlantServer::ConstructEventUpdate(const MarketEvent& e) {
-    auto final_event = std::make_shared<ms::StreamResponse>();
+SerializedResponse MarketPlantServer::ConstructEventUpdate(const BookUpdate& u, bool absolute) {
+    ms::StreamResponse* final_event = NewResponse();
     auto* update = final_event->mutable_update();
 
-    update->set_instrument_id(e.instrument_id);
+    update->set_instrument_id(u.event.instrument_id);
+    SetEventUpdate(update->mutable_incremental()->mutable_update(), u, absolute);
 
-    auto* curr = update->mutable_incremental()->mutable_update();
+    return Serialize(*final_event);
+}
+
+SerializedResponse MarketPlantServer::ConstructBatchUpdate(InstrumentId id, std::span<const BookUpdate> updates, bool absolute, std::uint32_t conflated) {
+    ms::StreamResponse* final_event = NewResponse();
+    auto* update = final_event->mutable_update();
+
+    update->set_instrument_id(id);
+
+    auto* batch = update->mutable_batch();
+    batch->mutable_updates()->Reserve(static_cast<int>(updates.size()));
+    for (const BookUpdate& u : updates) SetEventUpdate(batch->add_updates(), u, absolute);
+    batch->set_conflated(conflated);
+
+    return Serialize(*final_event);
+}
+
+SerializedResponse MarketPlantServer::Serialize(const ms::StreamResponse& response) {
+    // Writes copy the buffer by reference: the encoded slices are shared, never re-encoded. The
+    // buffer and its slices are still allocated per response; only the message tree is arena-backed
+    auto buffer = std::make_shared<grpc::ByteBuffer>();
+    bool own_buffer = false;
+    const Status status = grpc::SerializationTraits<ms::StreamResponse>::Serialize(response, buffer.get(), &own_buffer);
+    if (!status.ok()) [[unlikely]] {
+        throw std::runtime_error("Error: failed to serialize stream response: " + status.error_message());
+    }
+    return buffer;
+}
+
+// A thread's arena for outbound messages. Reset before each message, it keeps reusing its first
+// block, so building a message no larger than the block allocates nothing
+struct ResponseArena {
+    static constexpr std::size_t kBlockBytes = 64 << 10;
+
+    ResponseArena() : block(std::make_unique<char[]>(kBlockBytes)), arena(block.get(), kBlockBytes) {}
+
+    std::unique_ptr<char[]> block;
+    google::protobuf::Arena arena;
+};
+
+ms::StreamResponse* MarketPlantServer::NewResponse() {
+    thread_local ResponseArena local;
+    local.arena.Reset();
+    return google::protobuf::Arena::Create<ms::StreamResponse>(&local.arena);
+}
+
+void MarketPlantServer::SetEventUpdate(ms::OrderBookEventUpdate* curr, const BookUpdate& u, bool absolute) {
+    const MarketEvent& e = u.event;
 
     // Map event -> proto type
-    switch (e.event) {
-        case LevelEvent::kAddLevel: curr->set_type(ms::ADD_LEVEL); break;
-        case LevelEvent::kModifyLevel: curr->set_type(ms::REDUCE_LEVEL); break;
-        default: curr->set_type(ms::EVENT_UNSPECIFIED); break;
+    if (absolute) {
+        curr->set_type(ms::SET_LEVEL);
+    } else {
+        switch (e.event) {
+            case LevelEvent::kAddLevel: curr->set_type(ms::ADD_LEVEL); break;
+            case LevelEvent::kModifyLevel: curr->set_type(ms::REDUCE_LEVEL); break;
+            default: curr->set_type(ms::EVENT_UNSPECIFIED); break;
+        }
     }
 
     auto* level = curr->mutable_level();
@@ -350,15 +902,17 @@ StreamResponsePtr MarketPlantServer::ConstructEventUpdate(const MarketEvent& e)
     }
 
     level->set_price(e.price);
-    level->set_quantity(e.quantity);
+    level->set_quantity(absolute ? u.level_quantity : e.quantity);
+}
 
-    return final_event;
+Status MarketPlantServer::UnknownInstrument(InstrumentId id) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Error: unknown instrument id " + std::to_string(id));
 }
 
-Identifier MarketPlantServer::InitSubscriber() {
+Identifier MarketPlantServer::InitSubscriber(SubscriberId id) {
     // generate new subscriber
     Identifier new_sub{};
-    new_sub.subscriber_id = next_subscriber_id_++;
+    new_sub.subscriber_id = id;
     new_sub.session_key = SessionGenerator::Generate();
     return new_sub;
 }
@@ -375,24 +929,56 @@ int main(int argc, char* argv[]) {
     }
 
     MarketPlantConfig mp_config = MarketPlantConfig::New();
-    BookManager manager(conf.instruments);
 
-    // connect to exchange
-    auto feed = std::make_shared<ExchangeFeed>(manager, mp_config, conf.cpu_core);
-    std::thread exchange_feed([feed]{ feed->ConnectToExchange(); });
-    exchange_feed.detach();
+    // A batch is read whole, so every book's ring must hold the largest one with room to spare
+    const std::size_t broadcast_capacity = std::max(mp_config.broadcast_capacity, 2 * mp_config.batch_max_events * kMaxUpdatesPerEvent);
+    BookManager manager(conf.instruments, broadcast_capacity);
 
-    // gRPC server runs on main thread
-    MarketPlantServer service(manager);
+    // connect to exchange: one feed thread per channel, pinned to consecutive cores from '--cpu'
+    for (std::size_t channel = 0; channel < mp_config.feed_channels; ++channel) {
+        const int cpu_core = conf.cpu_core >= 0 ? conf.cpu_core + static_cast<int>(channel) : -1;
+        auto feed = std::make_shared<ExchangeFeed>(manager, mp_config, channel, cpu_core);
+        std::thread exchange_feed([feed]{ feed->ConnectToExchange(); });
+        exchange_feed.detach();
+    }
+
+    // gRPC server runs on main thread; every stream is served by a fixed pool of completion-queue threads
+    const StreamLimits limits{mp_config.subscriber_queue_capacity, mp_config.subscriber_max_backlog, mp_config.subscriber_max_bytes,
+                              mp_config.stream_memory_limit, mp_config.overflow_policy};
+    MarketPlantServer service(manager, limits, mp_config.max_subscribers);
+
+    if (mp_config.metrics_interval_s > 0) {
+        std::thread metrics([&service, &manager, interval = std::chrono::seconds(mp_config.metrics_interval_s)] {
+            while (true) {
+                std::this_thread::sleep_for(interval);
+                std::cout << "stream metrics: " << service.metrics().Report() << "\n";
+                std::cout << "feed metrics: unknown_events=" << manager.unknown_events() << "\n";
+                std::cout.flush();
+            }
+        });
+        metrics.detach();
+    }
 
     grpc::ServerBuilder builder;
     builder.AddListeningPort(mp_config.GetGrpcAddress(), grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
 
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> stream_queues;
+    for (std::size_t i = 0; i < mp_config.stream_threads; ++i) stream_queues.push_back(builder.AddCompletionQueue());
+
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
     std::cout << "gRPC listening on " << mp_config.GetGrpcAddress() << "\n";
 
+    std::vector<std::thread> stream_threads;
+    for (std::size_t i = 0; i < stream_queues.size(); ++i) {
+        const int cpu_core = mp_config.stream_cpu_core >= 0 ? mp_config.stream_cpu_core + static_cast<int>(i) : -1;
+        stream_threads.emplace_back([&service, cq = stream_queues[i].get(), cpu_core] { service.DriveStreams(cq, cpu_core); });
+    }
+
     server->Wait();
 
+    for (auto& cq : stream_queues) cq->Shutdown();
+    for (auto& stream_thread : stream_threads) stream_thread.join();
+
     return 0;
 }
\ No newline at end of file
@@ -2,30 +2,32 @@
 
 #include <atomic>
 #include <chrono>
-#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <random>
-#include <shared_mutex>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <grpcpp/alarm.h>
 #include <grpcpp/grpcpp.h>
 #include "market_plant/market_plant.grpc.pb.h"
 
 #include "event.h"
 #include "market_core.h"
+#include "market_plant_config.h"
+#include "mpsc_ring.h"
+#include "slot_registry.h"
 
 namespace ms = market_plant::v1;
 
 using grpc::Status;
 using grpc::ServerContext;
-using grpc::ServerWriter;
-using StreamResponsePtr = std::shared_ptr<const ms::StreamResponse>;
 
 class SessionGenerator {
 public:
@@ -41,57 +43,288 @@ struct Identifier {
 };
 
 
-// on construction, queue should be init to n snapshots of the n instruments subscribed to
-class Subscriber {
+// Bounds on what streams hold back (see MarketPlantConfig)
+struct StreamLimits {
+    std::size_t queue_capacity;         // subscription changes queued per subscriber
+    std::uint64_t max_backlog;          // unread level events per instrument before 'policy' applies
+    std::size_t max_bytes;              // bytes one stream holds drained but unwritten
+    std::size_t memory_ceiling;         // bytes every stream together holds drained but unwritten
+    OverflowPolicy policy;
+};
+
+// Accounting and policy actions across every stream
+struct StreamMetrics {
+    std::atomic<std::int64_t> streams{0};
+    std::atomic<std::int64_t> queued_bytes{0};          // drained but unwritten
+    std::atomic<std::uint64_t> throttled{0};            // drains cut short by a byte budget or the ceiling
+    std::atomic<std::uint64_t> lapped{0};               // cursors overwritten by the writer and resynced
+    std::atomic<std::uint64_t> overflow_resyncs{0};
+    std::atomic<std::uint64_t> overflow_conflations{0};
+    std::atomic<std::uint64_t> ceiling_crossings{0};    // times 'queued_bytes' reached the memory ceiling
+    std::atomic<bool> over_ceiling{false};
+    std::atomic<std::uint64_t> conflations{0};          // backlogs merged, opted in or by the overflow policy
+    std::atomic<std::uint64_t> conflated_updates{0};    // published updates those merges replaced
+    std::atomic<std::uint64_t> overflow_disconnects{0};
+
+    std::string Report() const;
+};
+
+// A change to the books a stream reads, applied by the stream thread in the order it was made
+struct CursorChange {
+    OrderBookBase* book = nullptr;      // nullptr: stop reading 'instrument_id'
+    InstrumentId instrument_id = 0;
+    std::uint64_t cursor = 0;           // first broadcast update 'snapshot' does not include
+    SerializedResponse snapshot;
+};
+
+/*
+on construction, queue should be init to n snapshots of the n instruments subscribed to
+
+Book updates are not queued per subscriber: the stream thread reads each subscribed book's
+broadcast ring through its own cursor and encodes what it reads, and a cursor lapped by the
+writer is resynced from a fresh snapshot. Only subscription changes (with their snapshots) are handed over through a
+bounded lock-free queue. The stream drains everything available at once and is only woken when
+it parked on an empty queue, so a burst of updates costs one wakeup however long it is.
+
+What one drain takes is bounded by the stream's byte budget and the global ceiling; the rest
+waits in the books' rings, and an instrument left too far behind gets the overflow policy.
+*/
+class Subscriber : public std::enable_shared_from_this<Subscriber> {
 public:
-    Subscriber(const Identifier& subscriber, const ms::InstrumentIds& instruments);
+    Subscriber(const Identifier& subscriber, const ms::InstrumentIds& instruments, const ms::SubscriptionOptions& options,
+               const StreamLimits& limits, StreamMetrics& metrics);
+
+    ~Subscriber();
+
+    // Control plane. Each change to one stream's subscriptions runs under its mutex, book registration
+    // and cursor hand-over included, so the book and the stream see them in the order they were made.
+    // Registers with 'book' and queues its snapshot; false if already subscribed or closed
+    bool Subscribe(OrderBookBase& book);
+
+    // Deregisters from 'book' and queues the cursor removal
+    void Unsubscribe(OrderBookBase& book);
 
-    bool Subscribe(InstrumentId id);
+    // Refuses further subscriptions; returns the instruments that were subscribed to
+    std::vector<InstrumentId> Close();
 
-    void Unsubscribe(InstrumentId id);
+    // Any thread; starts (or restarts) reading 'book' after 'snapshot'
+    void StartReading(OrderBookBase& book, std::uint64_t cursor, SerializedResponse snapshot);
 
-    void Enqueue(const StreamResponsePtr& next);
+    enum class DequeueResult : std::uint8_t {
+        kUpdates,       // every available update was appended to 'out'
+        kEmpty,         // nothing available: the waker is armed and runs once on the next publish
+        kClosed,        // unsubscribed from every instrument
+        kOverrun,       // the subscription change queue overflowed, or the disconnect policy applied
+    };
 
-    StreamResponsePtr WaitDequeue(ServerContext* ctx);
+    // Stream thread only; the previous round must have been written
+    DequeueResult Drain(std::vector<SerializedResponse>& out);
+
+    // Run from the publishing thread when an armed stream gets work; set before the first Drain
+    void SetWaker(std::function<void()> wake);
+
+    // Runs the waker if the stream is parked
+    void Wake();
+
+    // Stops waking the stream; false if a wake was already triggered and is still to be delivered
+    bool Disarm();
 
     const Identifier& subscriber() const { return subscriber_; }
 
+    // Receives SET_LEVEL updates with absolute level quantities instead of deltas
+    bool absolute_quantity() const { return absolute_quantity_; }
+
+    // Merges an instrument's backlog once more than this many level events wait (0 = never)
+    std::uint32_t conflate_backlog() const { return conflate_backlog_; }
+
 private:
+    // Position in one book's broadcast ring (stream thread only)
+    struct Cursor {
+        OrderBookBase* book;
+        std::uint64_t next;
+        std::uint64_t wake_epoch = 0;
+    };
+
+    void Apply(CursorChange& change, std::vector<SerializedResponse>& out);
+
+    // False once the round's budget is spent
+    bool ReadBook(Cursor& cursor, std::vector<SerializedResponse>& out);
+
+    // Applies the overflow policy to an instrument left more than 'max_backlog' updates behind, or
+    // behind at all while over the memory ceiling
+    void Overflow(Cursor& cursor, std::vector<SerializedResponse>& out);
+
+    // Appends 'response' to the round and accounts its bytes
+    void Take(SerializedResponse response, std::vector<SerializedResponse>& out);
+
+    // The round already holds something and the stream's budget or the global ceiling is reached
+    bool Throttled(const std::vector<SerializedResponse>& out);
+
+    // Every stream together holds 'memory_ceiling' bytes drained but unwritten; logs each crossing
+    bool OverCeiling();
+
+    // Sends everything waiting on 'cursor' as the net change per (side, price)
+    void Conflate(Cursor& cursor, std::vector<SerializedResponse>& out);
+
+    // Nothing left to read; registers with every book so the next publish wakes the stream
+    bool Exhausted();
+
     Identifier subscriber_;
+    bool absolute_quantity_;
+    std::uint32_t conflate_backlog_;
 
-    std::condition_variable cv_;
-    std::mutex mutex_;
-    
-    // queue of Update(s) to send
-    std::deque<StreamResponsePtr> updates_;
+    const StreamLimits& limits_;
+    StreamMetrics& metrics_;
+    std::size_t round_bytes_ = 0;       // drained in the current round (stream thread only)
+    std::size_t first_cursor_ = 0;      // rotates, so a throttled round does not starve later books
+
+    std::function<void()> wake_;
+    std::atomic<bool> armed_{false};
+    std::atomic<bool> overrun_{false};
+
+    // queue of subscription changes to apply
+    MpscRing<CursorChange> changes_;
+    std::vector<Cursor> cursors_;
+
+    // Level events of the batch being read (stream thread only)
+    std::vector<BookUpdate> batch_;
+
+    // Conflation scratch (stream thread only): latest update and quantity before the backlog per (side, price)
+    struct ConflatedLevel {
+        BookUpdate latest;
+        Quantity previous_quantity;
+    };
+    std::unordered_map<std::uint64_t, std::size_t> conflated_index_;
+    std::vector<ConflatedLevel> conflated_;
+    std::vector<BookUpdate> merged_;
 
-    // unordered_set of instruments subscribed to
+    // unordered_set of instruments subscribed to (control plane, under mutex)
+    std::mutex mutex_;
     std::unordered_set<InstrumentId> subscribed_to_;
+    bool closed_ = false;
+    std::atomic<std::size_t> subscriptions_{0};
+};
+
+class MarketPlantServer;
+
+/*
+One StreamUpdates call, driven by the completion queue it was requested on.
+
+Every asynchronous operation completes on that queue as one of the call's tags. At most one write
+is in flight; every wakeup drains everything available to the subscriber into 'batch_', written out
+in order before the books are looked at again. When it runs dry the call parks until a publish wakes
+it through an alarm on the same queue. The call deletes itself once the stream is done and its last tag returned.
+*/
+class StreamCall {
+public:
+    StreamCall(MarketPlantServer& server, grpc::ServerCompletionQueue* cq);
+
+    // Dispatches a completion-queue tag of any StreamCall
+    static void Proceed(void* tag, bool ok);
+
+private:
+    enum class Event : std::uint8_t { kNewCall, kWrite, kWake, kFinish, kDone };
+
+    struct Tag {
+        StreamCall* call;
+        Event event;
+    };
+
+    void Handle(Event event, bool ok);
+
+    void Start();
+
+    void WriteNext();
+
+    // Writes drained updates from 'next_' on as one UpdateBatch, up to kMaxCoalescedBytes
+    void WriteCoalesced();
+
+    // Keeps a coalesced message well under the 4 MB a gRPC client accepts by default
+    static constexpr std::size_t kMaxCoalescedBytes = 1 << 20;
+
+    void Finish(const Status& status);
+
+    MarketPlantServer& server_;
+    grpc::ServerCompletionQueue* cq_;
+
+    ServerContext ctx_;
+    grpc::ByteBuffer request_buffer_;
+    ms::Subscription request_;
+    grpc::ServerAsyncWriter<grpc::ByteBuffer> writer_{&ctx_};
+    grpc::Alarm alarm_;
+
+    std::shared_ptr<Subscriber> subscriber_;
+    SerializedResponse init_;
+    std::vector<SerializedResponse> batch_;  // drained updates, kept alive until written
+    std::size_t next_ = 0;
+
+    // Subscriber asked for UpdateBatch messages
+    bool coalesce_ = false;
+    grpc::ByteBuffer coalesced_;
+    std::vector<grpc::Slice> slices_;
+    std::vector<grpc::Slice> dumped_;
+
+    Tag new_call_tag_{this, Event::kNewCall};
+    Tag write_tag_{this, Event::kWrite};
+    Tag wake_tag_{this, Event::kWake};
+    Tag finish_tag_{this, Event::kFinish};
+    Tag done_tag_{this, Event::kDone};
+
+    int pending_ = 0;           // tags still to be returned by the queue (a parked wait counts as one)
+    bool parked_ = false;
+    bool closing_ = false;      // no further writes: finishing, failed write or cancelled
+    bool done_ = false;
 };
 
 // handle all subscription and order
-class MarketPlantServer final : public ms::MarketPlantService::Service {
+// StreamUpdates is served asynchronously by 'DriveStreams' threads as raw bytes, so each response is
+// serialized once per stream thread however many streams send it; the unary RPCs stay synchronous
+class MarketPlantServer final : public ms::MarketPlantService::WithRawMethod_StreamUpdates<ms::MarketPlantService::Service> {
 public:
-    explicit MarketPlantServer(BookManager& books);
+    // Up to 'max_subscribers' streams at once (rounded up to a power of two, at most SlotRegistry::kMaxSlots)
+    MarketPlantServer(BookManager& books, const StreamLimits& limits, std::size_t max_subscribers);
 
-    // Server-side streaming
-    Status StreamUpdates(ServerContext* context, const ms::Subscription* request, ServerWriter< ms::StreamResponse>* writer) override;
+    // Serves StreamUpdates calls on 'cq' until it is shut down (optionally pinned to 'cpu_core')
+    void DriveStreams(grpc::ServerCompletionQueue* cq, int cpu_core);
 
     // Control-plane for modifying subscriptions
     Status UpdateSubscriptions(ServerContext* context, const ms::UpdateSubscriptionRequest* request, google::protobuf::Empty* response) override;
 
-    std::shared_ptr<Subscriber> AddSubscriber(const ms::InstrumentIds& subscriptions);
+    // Lock-free snapshots of the published top-depth views
+    Status GetSnapshot(ServerContext* context, const ms::InstrumentIds* request, ms::SnapshotResponse* response) override;
+
+    // nullptr once 'max_subscribers' streams are open
+    std::shared_ptr<Subscriber> AddSubscriber(const ms::InstrumentIds& subscriptions, const ms::SubscriptionOptions& options);
 
-    void RemoveSubscriber(const SubscriberId id);
+    void RemoveSubscriber(Subscriber& subscriber);
 
-    static StreamResponsePtr ConstructEventUpdate(const MarketEvent& e);
+    // 'absolute' publishes SET_LEVEL with the level's resulting quantity instead of the delta
+    static SerializedResponse ConstructEventUpdate(const BookUpdate& u, bool absolute = false);
+
+    // One IncrementalBatch carrying 'updates' of instrument 'id' in order ('conflated' published updates merged)
+    static SerializedResponse ConstructBatchUpdate(InstrumentId id, std::span<const BookUpdate> updates, bool absolute = false, std::uint32_t conflated = 0);
+
+    static SerializedResponse Serialize(const ms::StreamResponse& response);
+
+    // An empty StreamResponse on this thread's arena, valid until the next call on the same thread:
+    // outbound messages only live until they are serialized
+    static ms::StreamResponse* NewResponse();
+
+    const StreamMetrics& metrics() const { return metrics_; }
 
 private:
-    static Identifier InitSubscriber();
+    friend class StreamCall;
+
+    static void SetEventUpdate(ms::OrderBookEventUpdate* curr, const BookUpdate& u, bool absolute);
+
+    static Identifier InitSubscriber(SubscriberId id);
+
+    static Status UnknownInstrument(InstrumentId id);
 
-    inline static std::atomic<SubscriberId> next_subscriber_id_{1};
     BookManager& books_;
+    const StreamLimits limits_;
+    StreamMetrics metrics_;
 
-    inline static std::shared_mutex sub_lock_;
-    std::unordered_map<SubscriberId, std::weak_ptr<Subscriber>> subscribers_;
+    // Subscriber ids are registry handles, so UpdateSubscriptions finds its subscriber without a lock
+    SlotRegistry<Subscriber> subscribers_;
 };
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/*
+Bounded multi-producer / single-consumer ring (Vyukov): every cell carries a sequence number
+that tells producers and the consumer whose turn it is, so a push is one CAS on the tail and a
+pop touches no shared counter at all.
+*/
+template <class T>
+class MpscRing {
+public:
+    // 'capacity' is rounded up to a power of two
+    explicit MpscRing(std::size_t capacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)),
+          mask_(capacity_ - 1),
+          cells_(std::make_unique<Cell[]>(capacity_)) {
+        for (std::size_t i = 0; i < capacity_; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Any thread; false if the ring is full
+    bool TryPush(T value) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[tail & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+            if (sequence == tail) {
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < tail) {
+                return false;   // the consumer has not freed this cell yet
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer only
+    bool TryPop(T& out) {
+        Cell& cell = cells_[head_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) return false;
+
+        out = std::move(cell.value);
+        cell.value = T{};
+        cell.sequence.store(head_ + capacity_, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    // Consumer only
+    bool empty() const {
+        return cells_[head_ & mask_].sequence.load(std::memory_order_acquire) != head_ + 1;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    alignas(64) std::size_t head_ = 0;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+Weakly held objects addressed by 32-bit handles: the slot index in the low bits and the slot's
+generation above them. Freeing a slot bumps its generation, so a stale handle stops matching
+before the slot can be reused. Slot indices take at most 20 bits, leaving at least 12 for the
+generation, and freed slots are reused oldest first: a stale handle can only match again after
+its slot has been reused 4095 times, and every other free slot at least as often.
+
+Every slot has its own lock, so lookups only ever contend with the removal of the object they
+look up. Claiming and freeing a slot also go through the free list's mutex.
+*/
+template <class T>
+class SlotRegistry {
+public:
+    static constexpr std::size_t kMaxSlots = std::size_t{1} << 20;
+
+    // 'capacity' is rounded up to a power of two, at most kMaxSlots
+    explicit SlotRegistry(std::size_t capacity)
+        : index_bits_(static_cast<int>(std::bit_width(std::bit_ceil(std::clamp<std::size_t>(capacity, 2, kMaxSlots)) - 1))),
+          index_mask_((std::uint32_t{1} << index_bits_) - 1),
+          generation_mask_((std::uint32_t{1} << (32 - index_bits_)) - 1),
+          slots_(std::make_unique<Slot[]>(std::size_t{index_mask_} + 1)) {
+        free_.resize(std::size_t{index_mask_} + 1);
+        for (std::uint32_t i = 0; i <= index_mask_; ++i) free_[i] = i;
+        free_count_ = free_.size();
+    }
+
+    // Claims a slot and stores make(handle) in it; nullptr if every slot is taken
+    template <class Make>
+    std::shared_ptr<T> Emplace(Make&& make) {
+        std::uint32_t index;
+        {
+            std::lock_guard<std::mutex> lock(free_mutex_);
+            if (free_count_ == 0) return nullptr;
+            index = free_[free_head_];
+            free_head_ = (free_head_ + 1) & index_mask_;
+            --free_count_;
+        }
+
+        Slot& slot = slots_[index];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+
+        std::shared_ptr<T> value;
+        try {
+            value = make(slot.generation << index_bits_ | index);
+        } catch (...) {
+            Release(index);
+            throw;
+        }
+        slot.value = value;
+        return value;
+    }
+
+    // nullptr for a stale or unknown handle, or an object already gone
+    std::shared_ptr<T> Find(std::uint32_t handle) const {
+        Slot& slot = slots_[handle & index_mask_];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        return slot.generation == handle >> index_bits_ ? slot.value.lock() : nullptr;
+    }
+
+    // False if 'handle' is stale
+    bool Erase(std::uint32_t handle) {
+        const std::uint32_t index = handle & index_mask_;
+        Slot& slot = slots_[index];
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            if (slot.generation != handle >> index_bits_) return false;
+
+            slot.generation = std::max<std::uint32_t>((slot.generation + 1) & generation_mask_, 1);
+            slot.value.reset();
+        }
+        Release(index);
+        return true;
+    }
+
+    std::size_t capacity() const { return std::size_t{index_mask_} + 1; }
+
+    // Distinct generations a slot cycles through before its handles repeat
+    std::uint32_t generations() const { return generation_mask_; }
+
+private:
+    struct Slot {
+        std::mutex mutex;
+        std::uint32_t generation = 1;       // never 0, so no handle is 0
+        std::weak_ptr<T> value;
+    };
+
+    void Release(std::uint32_t index) {
+        std::lock_guard<std::mutex> lock(free_mutex_);
+        free_[(free_head_ + free_count_++) & index_mask_] = index;
+    }
+
+    const int index_bits_;
+    const std::uint32_t index_mask_;
+    const std::uint32_t generation_mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    // FIFO of free slot indices: 'free_count_' of them from 'free_head_', wrapping
+    std::mutex free_mutex_;
+    std::vector<std::uint32_t> free_;
+    std::uint32_t free_head_ = 0;
+    std::size_t free_count_ = 0;
+};
@@ -5,29 +5,47 @@
 #include "market_core.h"
 
 #include <arpa/inet.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <cerrno>
 #include <cstdint>
 #include <iostream>
+#include <span>
 #include <stdexcept>
 
-ExchangeFeed::ExchangeFeed(BookManager& books, const MarketPlantConfig& mp_config, int cpu_core)
+ExchangeFeed::ExchangeFeed(BookManager& books, const MarketPlantConfig& mp_config, std::size_t channel, int cpu_core)
     : sockfd_(socket(AF_INET, SOCK_DGRAM, 0)),
-        protocol_(0, sockfd_, mp_config.exchange_ip, mp_config.exchange_port),
+        protocol_(0, sockfd_, mp_config.exchange_ip, mp_config.ExchangePort(channel)),
         books_(books),
-        cpu_core_(cpu_core) {
+        channel_(channel),
+        cpu_core_(cpu_core),
+        batch_window_(mp_config.batch_window_us),
+        batch_max_events_(mp_config.batch_max_events) {
     
+    batch_.reserve(batch_max_events_);
+
     if (sockfd_ < 0) throw std::runtime_error("Error: socket creation to exchange failed.");
+
+    // Channels may share one port: the kernel delivers each exchange channel to the socket connected to it
+    if (mp_config.feed_reuseport) {
+        int enable = 1;
+        if (setsockopt(sockfd_, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) < 0) {
+            close(sockfd_);
+            sockfd_ = -1;
+            throw std::runtime_error("Error: failed to set SO_REUSEPORT.");
+        }
+    }
     
     // MARKET
-    sockaddr_in plantaddr = ConstructIpv4(mp_config.market_ip, mp_config.market_port);
+    sockaddr_in plantaddr = ConstructIpv4(mp_config.market_ip, mp_config.MarketPort(channel));
     if (bind(sockfd_, reinterpret_cast<sockaddr*>(&plantaddr), sizeof(plantaddr)) < 0) {
         throw std::runtime_error("Error: bind failed.");
     }
 
     // EXCHANGE
-    sockaddr_in exaddr = ConstructIpv4(mp_config.exchange_ip, mp_config.exchange_port);
+    sockaddr_in exaddr = ConstructIpv4(mp_config.exchange_ip, mp_config.ExchangePort(channel));
     if (connect(sockfd_, reinterpret_cast<sockaddr*>(&exaddr), sizeof(exaddr)) < 0) {
         throw std::runtime_error("udp connect failed");
     }
@@ -40,36 +58,80 @@ ExchangeFeed::~ExchangeFeed() {
 void ExchangeFeed::ConnectToExchange() {
     if (cpu_core_ >= 0) {
         if (CPUAffinity::PinToCore(cpu_core_)) [[likely]] 
-            std::cout << "Successfully pinned Exchange Feed to core " << cpu_core_ << ".\n";
+            std::cout << "Successfully pinned Exchange Feed channel " << channel_ << " to core " << cpu_core_ << ".\n";
         else {
-            std::cout << "Failed to pin Exchange Feed to core " << cpu_core_ << ".\n";
+            std::cout << "Failed to pin Exchange Feed channel " << channel_ << " to core " << cpu_core_ << ".\n";
         }
     }
 
     std::uint8_t buf[512];
+    Clock::time_point deadline{};
 
     while (true) {
-        ssize_t n = recvfrom(sockfd_, buf, sizeof(buf), 0, nullptr, nullptr);
-        if (n <= 0) [[unlikely]] continue;
+        // Block for the first event of a batch; afterwards only drain what is already queued
+        const bool batching = !batch_.empty();
+        ssize_t n = recvfrom(sockfd_, buf, sizeof(buf), batching ? MSG_DONTWAIT : 0, nullptr, nullptr);
+        if (n <= 0) [[unlikely]] {
+            if (batching && (errno == EAGAIN || errno == EWOULDBLOCK) && !WaitForPacket(deadline)) FlushBatch();
+            continue;
+        }
         
         try {
             if (protocol_.HandlePacket(buf, static_cast<Bytes>(n))) {
                 auto message = protocol_.message_view();
                 HandleEvent(message);
+                if (batch_.size() == 1) deadline = Clock::now() + batch_window_;
             }
         } catch (const PacketTruncatedError& e) {
             std::cerr << e.what() << "\n";
         }
+
+        if (batch_.size() >= batch_max_events_) FlushBatch();
+    }
+}
+
+bool ExchangeFeed::WaitForPacket(Clock::time_point deadline) const {
+    const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now());
+    if (remaining.count() <= 0) return false;
+
+    pollfd fd{sockfd_, POLLIN, 0};
+    timespec timeout{
+        static_cast<time_t>(remaining.count() / 1'000'000'000),
+        static_cast<long>(remaining.count() % 1'000'000'000)
+    };
+    return ppoll(&fd, 1, &timeout, nullptr) > 0;
+}
+
+void ExchangeFeed::FlushBatch() {
+    if (batch_.size() == 1) {
+        books_.Book(batch_.front().instrument_id).PushEventToSubscribers(batch_.front());
+        batch_.clear();
+        return;
+    }
+
+    // Stable insertion sort by instrument: batches are small and mostly grouped already
+    for (std::size_t i = 1; i < batch_.size(); ++i) {
+        MarketEvent e = batch_[i];
+        std::size_t j = i;
+        for (; j > 0 && batch_[j - 1].instrument_id > e.instrument_id; --j) batch_[j] = batch_[j - 1];
+        batch_[j] = e;
+    }
+
+    for (std::size_t first = 0; first < batch_.size(); ) {
+        std::size_t last = first + 1;
+        while (last < batch_.size() && batch_[last].instrument_id == batch_[first].instrument_id) ++last;
+        books_.Book(batch_[first].instrument_id).ApplyBatch(std::span<const MarketEvent>(batch_.data() + first, last - first));
+        first = last;
     }
+    batch_.clear();
 }
 
-const OrderBook& ExchangeFeed::GetOrderBook(InstrumentId id) const {
+const OrderBookBase& ExchangeFeed::GetOrderBook(InstrumentId id) const {
     return books_.Book(id);
 }   
 
 void ExchangeFeed::HandleEvent(const MessageView& message) {
-    MarketEvent e = ParseEvent(message);
-    books_.Book(e.instrument_id).PushEventToSubscribers(e);
+    batch_.push_back(ParseEvent(message));
 }
 
 MarketEvent ExchangeFeed::ParseEvent(const MessageView& message) {
@@ -85,6 +147,16 @@ MarketEvent ExchangeFeed::ParseEvent(const MessageView& message) {
     m_event.quantity = ReadBigEndian<Quantity>(p, off); off += sizeof(Quantity);
     m_event.exchange_ts = ReadBigEndian<Timestamp>(p, off); off += sizeof(Timestamp);
 
+    if (IsOrderEvent(m_event.event)) {
+        const Bytes expected = m_event.event == LevelEvent::kReplaceOrder ? kReplaceMessageLength : kOrderMessageLength;
+        if (message.len < expected) [[unlikely]] throw PacketTruncatedError(message.len, expected);
+
+        m_event.order_id = ReadBigEndian<OrderId>(p, off); off += sizeof(OrderId);
+        if (m_event.event == LevelEvent::kReplaceOrder) {
+            m_event.new_order_id = ReadBigEndian<OrderId>(p, off); off += sizeof(OrderId);
+        }
+    }
+
     return m_event;
 }
 
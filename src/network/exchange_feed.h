@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <netinet/in.h>
 
@@ -10,21 +13,27 @@
 #include "moldudp64.h"
 
 class BookManager;
-class OrderBook;
+class OrderBookBase;
 
 class ExchangeFeed {
 public:
-    ExchangeFeed(BookManager& books, const MarketPlantConfig& mp_config, int cpu_core = -1);
+    ExchangeFeed(BookManager& books, const MarketPlantConfig& mp_config, std::size_t channel = 0, int cpu_core = -1);
     
     ~ExchangeFeed();
 
     void ConnectToExchange();
     
-    const OrderBook& GetOrderBook(InstrumentId id) const;
+    const OrderBookBase& GetOrderBook(InstrumentId id) const;
 
 private:
     void HandleEvent(const MessageView& message);
 
+    // Waits for the socket to become readable until 'deadline'; false once the window has closed
+    bool WaitForPacket(Clock::time_point deadline) const;
+
+    // Applies the pending events grouped by instrument, one publish per instrument
+    void FlushBatch();
+
     MarketEvent ParseEvent(const MessageView& message);
 
     sockaddr_in ConstructIpv4(const std::string& ip, std::uint16_t port);
@@ -32,5 +41,10 @@ private:
     int sockfd_{-1};
     MoldUDP64 protocol_;
     BookManager& books_;
+    std::size_t channel_;
     int cpu_core_;
+
+    std::chrono::microseconds batch_window_;
+    std::size_t batch_max_events_;
+    std::vector<MarketEvent> batch_;
 };
\ No newline at end of file
@@ -19,6 +19,17 @@ inline T ReadBigEndian(const std::uint8_t* buf,  Bytes offset) {
     return converted;
 }
 
+// Little-endian reads (ex. host-order capture file headers)
+template <std::unsigned_integral T>
+inline T ReadLittleEndian(const std::uint8_t* buf, Bytes offset) {
+    T converted = 0;
+    for (Bytes i = sizeof(T); i > 0; --i) {
+        converted <<= 8;
+        converted = converted | static_cast<T>(buf[offset + i - 1]);
+    }
+    return converted;
+}
+
 template <std::unsigned_integral T>
 inline void WriteBigEndian(std::uint8_t* buf, Bytes offset, T value) {
     for (Bytes i = 0; i < sizeof(T); ++i) {
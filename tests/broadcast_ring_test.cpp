@@ -0,0 +1,205 @@
+#include "broadcast_ring.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <thread>
+#include <vector>
+
+/*
+Multi-reader stress of BroadcastRing. One writer publishes batches of updates whose every word is
+derived from their sequence number, into a ring small enough to wrap constantly. Readers held in
+lockstep with the writer must see every update in order; readers that stall, or that keep reading
+the slot the writer overwrites next, must be told they were lapped (kOverrun), never handed a torn
+or out-of-order value.
+*/
+
+namespace {
+
+struct Update {
+    std::uint64_t sequence;
+    std::array<std::uint64_t, 6> words;
+};
+
+using Ring = BroadcastRing<Update>;
+
+constexpr std::size_t kCapacity = 64;
+constexpr std::size_t kReaders = 4;
+constexpr std::size_t kMaxBatch = 4;
+constexpr std::uint64_t kUpdates = 2000000;
+
+Update Make(std::uint64_t sequence) {
+    Update u{sequence, {}};
+    for (std::size_t i = 0; i < u.words.size(); ++i) u.words[i] = sequence * 0x9E3779B97F4A7C15ull + i;
+    return u;
+}
+
+bool Valid(const Update& u, std::uint64_t cursor) {
+    const Update expected = Make(cursor);
+    return u.sequence == expected.sequence && u.words == expected.words;
+}
+
+struct ReaderStats {
+    std::uint64_t read = 0;
+    std::uint64_t overruns = 0;
+    std::uint64_t invalid = 0;
+};
+
+// Publishes kUpdates in batches of 1..kMaxBatch; 'wait' blocks until a batch of n may be written
+template <class Wait>
+void Write(Ring& ring, std::atomic<bool>& done, Wait wait) {
+    std::array<Update, kMaxBatch> batch;
+    std::uint64_t next = 0;
+    while (next < kUpdates) {
+        const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(next % kMaxBatch + 1, kUpdates - next));
+        for (std::size_t i = 0; i < n; ++i) batch[i] = Make(next + i);
+
+        wait(next, n);
+        ring.Publish(std::span<const Update>(batch.data(), n));
+        next += n;
+    }
+    done.store(true, std::memory_order_release);
+}
+
+enum class Mode : std::uint8_t {
+    kKeepUp,
+    kStall,         // sleeps now and then, so the writer laps it
+    kTail,          // always reads the oldest update in the ring: the slot the writer overwrites next
+};
+
+// Reads until the writer is done; a lapped reader resyncs at the writer's position
+void Read(const Ring& ring, const std::atomic<bool>& done, std::atomic<std::uint64_t>& progress, Mode mode, ReaderStats& stats) {
+    std::uint64_t cursor = 0;
+    Update u{};
+    while (true) {
+        const bool finished = done.load(std::memory_order_acquire);
+        if (mode == Mode::kTail) {
+            if (finished || stats.read == kUpdates) return;
+            const std::uint64_t next = ring.next();
+            cursor = next - std::min<std::uint64_t>(next, ring.capacity());
+        }
+        switch (ring.Read(cursor, u)) {
+            case Ring::ReadResult::kPending:
+                if (finished) return;
+                std::this_thread::yield();
+                break;
+
+            case Ring::ReadResult::kOverrun:
+                ++stats.overruns;
+                cursor = ring.next();
+                break;
+
+            case Ring::ReadResult::kReady:
+                if (!Valid(u, cursor)) ++stats.invalid;
+                ++stats.read;
+                progress.store(++cursor, std::memory_order_release);
+                if (mode == Mode::kStall && cursor % 1024 == 0) std::this_thread::sleep_for(std::chrono::microseconds(100));
+                break;
+        }
+    }
+}
+
+// Readers never fall a full ring behind: each must read every update, in order
+int RunLockstep() {
+    Ring ring(kCapacity);
+    std::atomic<bool> done{false};
+    std::array<std::atomic<std::uint64_t>, kReaders> progress{};
+    std::array<ReaderStats, kReaders> stats{};
+
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&, r] { Read(ring, done, progress[r], Mode::kKeepUp, stats[r]); });
+    }
+
+    Write(ring, done, [&](std::uint64_t next, std::size_t n) {
+        for (const auto& p : progress) {
+            while (next + n - p.load(std::memory_order_acquire) > ring.capacity()) std::this_thread::yield();
+        }
+    });
+    for (auto& reader : readers) reader.join();
+
+    int failures = 0;
+    for (std::size_t r = 0; r < kReaders; ++r) {
+        std::printf("lockstep reader %zu: %llu read, %llu overruns, %llu invalid\n", r, static_cast<unsigned long long>(stats[r].read),
+                    static_cast<unsigned long long>(stats[r].overruns), static_cast<unsigned long long>(stats[r].invalid));
+        if (stats[r].read != kUpdates || stats[r].overruns != 0 || stats[r].invalid != 0) ++failures;
+    }
+    return failures;
+}
+
+// The writer only paces itself on reader 0; the others stall or chase the tail, so they are lapped
+// and race the writer on the slot it is overwriting, yet none may see a partial or out-of-order update
+int RunOverrun() {
+    constexpr std::array<Mode, kReaders> kModes = {Mode::kKeepUp, Mode::kStall, Mode::kKeepUp, Mode::kTail};
+
+    Ring ring(kCapacity);
+    std::atomic<bool> done{false};
+    std::array<std::atomic<std::uint64_t>, kReaders> progress{};
+    std::array<ReaderStats, kReaders> stats{};
+
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&, r] { Read(ring, done, progress[r], kModes[r], stats[r]); });
+    }
+
+    Write(ring, done, [&](std::uint64_t next, std::size_t n) {
+        while (next + n - progress[0].load(std::memory_order_acquire) > ring.capacity() / 2) std::this_thread::yield();
+    });
+    for (auto& reader : readers) reader.join();
+
+    int failures = 0;
+    for (std::size_t r = 0; r < kReaders; ++r) {
+        static constexpr const char* kNames[] = {"keeping up", "stalling", "tailing"};
+        std::printf("overrun reader %zu (%s): %llu read, %llu overruns, %llu invalid\n", r, kNames[static_cast<int>(kModes[r])],
+                    static_cast<unsigned long long>(stats[r].read), static_cast<unsigned long long>(stats[r].overruns),
+                    static_cast<unsigned long long>(stats[r].invalid));
+        if (stats[r].read == 0 || stats[r].invalid != 0 || (kModes[r] == Mode::kStall && stats[r].overruns == 0)) ++failures;
+    }
+    return failures;
+}
+
+// Single-threaded edges: rounding, pending, batch visibility and the overrun boundary
+int RunEdges() {
+    Ring ring(5);
+    Update u{};
+    int failures = 0;
+    auto check = [&](bool ok, const char* what) {
+        if (!ok) {
+            std::printf("edge case failed: %s\n", what);
+            ++failures;
+        }
+    };
+
+    check(ring.capacity() == 8, "capacity rounds up to a power of two");
+    check(ring.Read(0, u) == Ring::ReadResult::kPending, "empty ring is pending");
+
+    std::array<Update, 8> batch;
+    for (std::uint64_t i = 0; i < batch.size(); ++i) batch[i] = Make(i);
+    ring.Publish(batch);
+    check(ring.next() == 8, "a batch advances the cursor by its size");
+    check(ring.Read(0, u) == Ring::ReadResult::kReady && Valid(u, 0), "oldest update of a full ring is readable");
+    check(ring.Read(8, u) == Ring::ReadResult::kPending, "next sequence is pending");
+
+    const Update one = Make(8);
+    ring.Publish(std::span<const Update>(&one, 1));
+    check(ring.Read(0, u) == Ring::ReadResult::kOverrun, "overwritten update is overrun");
+    check(ring.Read(1, u) == Ring::ReadResult::kReady && Valid(u, 1), "update a full ring behind is readable");
+    check(ring.Read(8, u) == Ring::ReadResult::kReady && Valid(u, 8), "newest update is readable");
+    return failures;
+}
+
+}  // namespace
+
+int main() {
+    int failures = 0;
+    failures += RunEdges();
+    failures += RunLockstep();
+    failures += RunOverrun();
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
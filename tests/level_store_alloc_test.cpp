@@ -0,0 +1,212 @@
+#include "level_store.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <random>
+#include <vector>
+
+/*
+Checks that a warmed-up TreeLevels side makes no heap calls per event: erased nodes go back to
+the side's LevelPool and are reused by the next Add. Also churns a PriceLadder around a drifting
+price over a range several windows wide, so levels keep moving between the window and its pooled
+fallback through Recenter; its levels are checked against a model. Every global operator new is
+counted.
+*/
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr Price kMid = 10000;
+constexpr Price kLevels = 256;
+constexpr std::size_t kEvents = 1000000;
+
+template <Side kSide>
+int Run(const char* name) {
+    TreeLevels<kSide> levels;
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<Price> price(kMid - kLevels / 2, kMid + kLevels / 2 - 1);
+    std::uniform_int_distribution<Quantity> quantity(1, 500);
+
+    auto step = [&] {
+        const Price p = price(generator);
+        if (generator() & 1) {
+            levels.Add(p, quantity(generator));
+        } else {
+            levels.Reduce(p, quantity(generator));
+        }
+    };
+
+    // Warm-up: every price in the band gets a node, so the pool holds the full working set
+    for (Price p = kMid - kLevels / 2; p < kMid + kLevels / 2; ++p) levels.Add(p, 1);
+    for (Price p = kMid - kLevels / 2; p < kMid + kLevels / 2; ++p) levels.Reduce(p, 1);
+    for (std::size_t i = 0; i < kEvents / 10; ++i) step();
+
+    const std::size_t before = allocations.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < kEvents; ++i) step();
+    const std::size_t made = allocations.load(std::memory_order_relaxed) - before;
+
+    std::printf("%s: %zu allocations over %zu events (%zu live levels)\n", name, made, kEvents, levels.size());
+    return made == 0 ? 0 : 1;
+}
+
+// Prices are drawn around a center that random-walks over a range of several ladder windows, so the
+// best price keeps leaving the window (recentering it) and levels far from it rest in the fallback.
+// With 'tick_size' > 1 most prices are off the grid and live in the fallback throughout.
+template <Side kSide>
+int RunLadder(const char* name, Price tick_size) {
+    constexpr Price kWindow = static_cast<Price>(PriceLadder<kSide>::kWindowTicks);
+    constexpr Price kDrift = 2 * kWindow;       // the center walks kMid +- kDrift
+    constexpr Price kSpread = kWindow / 2;      // prices are drawn center +- kSpread
+    constexpr Price kLow = kMid + 2 * kWindow - kDrift - kSpread;
+    constexpr Price kHigh = kMid + 2 * kWindow + kDrift + kSpread;
+
+    PriceLadder<kSide> ladder(tick_size);
+    std::vector<Quantity> model(kHigh - kLow + 1, 0);      // by price - kLow
+    std::vector<Price> live;                                // prices with a level, in any order
+    std::vector<std::size_t> live_slot(model.size());       // by price - kLow: position in 'live'
+    live.reserve(model.size());
+    std::mt19937_64 generator(7);
+    std::uniform_int_distribution<Quantity> quantity(1, 500);
+    Price center = kMid + 2 * kWindow;
+    std::size_t mismatches = 0;
+
+    // Deletes the level at 'p' (which must exist) from the ladder and the model
+    auto remove = [&](Price p) {
+        Quantity& level = model[p - kLow];
+        const std::optional<Quantity> previous = ladder.Reduce(p, level);
+        if (!previous || *previous != level) ++mismatches;
+        level = 0;
+        const Price moved = live.back();
+        live[live_slot[p - kLow]] = moved;
+        live_slot[moved - kLow] = live_slot[p - kLow];
+        live.pop_back();
+    };
+
+    // Adds land around the center and reduces hit live levels. When the center moves, levels left
+    // outside its spread are deleted, so the best price follows it in and out of the window.
+    auto step = [&] {
+        if (generator() % 500 == 0) {
+            center = generator() & 1 ? std::min(center + kSpread / 2, kHigh - kSpread) : std::max(center - kSpread / 2, kLow + kSpread);
+            for (std::size_t i = 0; i < live.size(); ) {
+                const Price p = live[i];
+                if (p + kSpread < center || p > center + kSpread) {
+                    remove(p);
+                } else {
+                    ++i;
+                }
+            }
+        }
+        const bool add = live.empty() || generator() & 1;
+        const Price p = add || generator() % 8 == 0 ? std::uniform_int_distribution<Price>(center - kSpread, center + kSpread)(generator)
+                                                    : live[generator() % live.size()];
+        Quantity& level = model[p - kLow];
+
+        if (add) {
+            const Quantity q = quantity(generator);
+            if (ladder.Add(p, q) != (level == 0)) ++mismatches;
+            if (level == 0) {
+                live_slot[p - kLow] = live.size();
+                live.push_back(p);
+            }
+            level += q;
+            return;
+        }
+
+        // Half the reduces delete the level outright
+        const Quantity q = generator() & 1 ? quantity(generator) : 500;
+        const std::optional<Quantity> previous = ladder.Reduce(p, q);
+        if (previous.has_value() != (level != 0) || (previous && *previous != level)) ++mismatches;
+        if (level != 0 && q >= level) {
+            level = 0;
+            const Price moved = live.back();
+            live[live_slot[p - kLow]] = moved;
+            live_slot[moved - kLow] = live_slot[p - kLow];
+            live.pop_back();
+        } else if (level != 0) {
+            level -= q;
+        }
+    };
+
+    // Every level, best to worst, must match the model
+    auto check = [&] {
+        if (ladder.size() != live.size()) ++mismatches;
+        std::size_t i = kSide == Side::kBid ? model.size() : 0;
+        auto next_level = [&]() -> std::size_t {
+            if constexpr (kSide == Side::kBid) {
+                while (i > 0 && model[i - 1] == 0) --i;
+                return i == 0 ? model.size() : --i;
+            } else {
+                while (i < model.size() && model[i] == 0) ++i;
+                return i == model.size() ? i : i++;
+            }
+        };
+        ladder.ForEach([&](Price price, Quantity q) {
+            const std::size_t expected = next_level();
+            if (expected == model.size() || price != kLow + expected || q != model[expected]) ++mismatches;
+            return true;
+        });
+        const std::optional<PriceLevel> best = ladder.Best();
+        i = kSide == Side::kBid ? model.size() : 0;
+        const std::size_t expected = next_level();
+        if (best.has_value() != (expected != model.size()) || (best && (best->price != kLow + expected || best->quantity != model[expected]))) {
+            ++mismatches;
+        }
+    };
+
+    // Warm-up: with a level resting past the range on the better side, every price of the range goes
+    // to the fallback at once, so the pool holds a node for each level the range can ever hold
+    const Price sentinel = kSide == Side::kBid ? kHigh + kWindow : kLow - kWindow;
+    ladder.Add(sentinel, 1);
+    for (Price p = kLow; p <= kHigh; ++p) ladder.Add(p, 1);
+    for (Price p = kLow; p <= kHigh; ++p) ladder.Reduce(p, 1);
+    ladder.Reduce(sentinel, 1);
+    for (std::size_t i = 0; i < kEvents / 10; ++i) step();
+    check();
+
+    std::size_t made = 0;
+    for (std::size_t i = 0; i < kEvents; ++i) {
+        const std::size_t before = allocations.load(std::memory_order_relaxed);
+        step();
+        made += allocations.load(std::memory_order_relaxed) - before;
+        if (i % 1000 == 0) check();
+    }
+    check();
+
+    std::printf("%s (tick %u): %zu allocations over %zu events (%zu live levels), %zu mismatches\n", name, tick_size, made, kEvents,
+                ladder.size(), mismatches);
+    return made == 0 && mismatches == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main() {
+    int failures = 0;
+    failures += Run<Side::kBid>("TreeLevels<kBid>");
+    failures += Run<Side::kAsk>("TreeLevels<kAsk>");
+    failures += RunLadder<Side::kBid>("PriceLadder<kBid>", 1);
+    failures += RunLadder<Side::kAsk>("PriceLadder<kAsk>", 1);
+    failures += RunLadder<Side::kBid>("PriceLadder<kBid>", 5);
+    failures += RunLadder<Side::kAsk>("PriceLadder<kAsk>", 5);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
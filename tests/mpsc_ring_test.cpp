@@ -0,0 +1,135 @@
+#include "mpsc_ring.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/*
+Stress of MpscRing. Several producers push tagged sequences into a ring small enough to be full
+most of the time, retrying when it is; the consumer must receive every item exactly once and each
+producer's items in the order they were pushed. Single-threaded cases cover rounding, full and
+empty rings and wrap-around.
+*/
+
+namespace {
+
+using Ring = MpscRing<std::uint64_t>;
+
+constexpr std::size_t kProducers = 4;
+constexpr std::uint64_t kItemsPerProducer = 500000;
+
+std::uint64_t Tag(std::size_t producer, std::uint64_t i) {
+    return static_cast<std::uint64_t>(producer) << 32 | i;
+}
+
+// Producers race on the tail; the consumer checks loss, duplication and per-producer order. A lost
+// item would leave the consumer waiting, so it gives up once nothing arrives for kStallTimeout.
+int RunProducers(std::size_t capacity) {
+    constexpr auto kStallTimeout = std::chrono::seconds(10);
+
+    Ring ring(capacity);
+    std::atomic<std::size_t> ready{0};
+    std::atomic<bool> stop{false};
+    std::array<std::uint64_t, kProducers> full{};
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p] {
+            ready.fetch_add(1, std::memory_order_relaxed);
+            while (ready.load(std::memory_order_relaxed) < kProducers) std::this_thread::yield();
+
+            for (std::uint64_t i = 0; i < kItemsPerProducer; ++i) {
+                while (!ring.TryPush(Tag(p, i))) {
+                    if (stop.load(std::memory_order_relaxed)) return;
+                    ++full[p];
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<std::uint64_t, kProducers> next{};      // next index expected from each producer
+    std::uint64_t received = 0;
+    std::uint64_t invalid = 0;
+    std::uint64_t empty = 0;
+    std::uint64_t item = 0;
+    auto last_item = std::chrono::steady_clock::now();
+    while (received < kProducers * kItemsPerProducer) {
+        if (!ring.TryPop(item)) {
+            if (++empty % 1024 == 0 && std::chrono::steady_clock::now() - last_item > kStallTimeout) break;
+            std::this_thread::yield();
+            continue;
+        }
+        last_item = std::chrono::steady_clock::now();
+        const std::size_t p = static_cast<std::size_t>(item >> 32);
+        if (p >= kProducers || (item & 0xFFFFFFFF) != next[p]) {
+            ++invalid;
+        } else {
+            ++next[p];
+        }
+        ++received;
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& producer : producers) producer.join();
+
+    // Everything pushed was popped: nothing may be left, and every producer must be complete
+    const bool drained = ring.empty() && !ring.TryPop(item);
+    std::uint64_t fulls = 0;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        fulls += full[p];
+        if (next[p] != kItemsPerProducer) ++invalid;
+    }
+
+    std::printf("capacity %zu: %llu received, %llu invalid, %llu full pushes, %llu empty pops, %s\n", ring.capacity(),
+                static_cast<unsigned long long>(received), static_cast<unsigned long long>(invalid),
+                static_cast<unsigned long long>(fulls), static_cast<unsigned long long>(empty), drained ? "drained" : "not drained");
+    return invalid == 0 && drained ? 0 : 1;
+}
+
+// Single-threaded edges: rounding, full, empty and order across wrap-around
+int RunEdges() {
+    Ring ring(5);
+    std::uint64_t item = 0;
+    int failures = 0;
+    auto check = [&](bool ok, const char* what) {
+        if (!ok) {
+            std::printf("edge case failed: %s\n", what);
+            ++failures;
+        }
+    };
+
+    check(ring.capacity() == 8, "capacity rounds up to a power of two");
+    check(ring.empty() && !ring.TryPop(item), "new ring is empty");
+
+    for (std::uint64_t i = 0; i < ring.capacity(); ++i) check(ring.TryPush(i), "push below capacity succeeds");
+    check(!ring.TryPush(99), "push into a full ring fails");
+    check(ring.TryPop(item) && item == 0, "pop returns the oldest item");
+    check(ring.TryPush(8), "a pop frees one cell");
+    check(!ring.TryPush(99), "the ring is full again");
+
+    // Keep one item in flight per push across many laps of the ring
+    std::uint64_t expected = 1;
+    for (std::uint64_t i = 9; i < 1000; ++i) {
+        check(ring.TryPop(item) && item == expected++, "items come out in push order");
+        check(ring.TryPush(i), "push after pop succeeds");
+    }
+    while (ring.TryPop(item)) check(item == expected++, "drain keeps push order");
+    check(expected == 1000 && ring.empty(), "every item is popped once");
+    return failures;
+}
+
+}  // namespace
+
+int main() {
+    int failures = 0;
+    failures += RunEdges();
+    failures += RunProducers(2);
+    failures += RunProducers(64);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
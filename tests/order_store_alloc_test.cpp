@@ -0,0 +1,211 @@
+#include "open_hash.h"
+#include "order_store.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+/*
+Checks that OrderStore makes no heap calls per message once sized for its resting orders: nodes
+are recycled through the free list and both hash tables stay within their initial slots. Level
+events are checked against a model of the resting orders. Also drives OpenHashMap::Erase over
+keys that collide (and wrap around the end of the table) against a model, so backward-shift
+deletion must keep every remaining key reachable. Every global operator new is counted.
+*/
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr std::size_t kCapacity = 4096;
+constexpr Price kMid = 10000;
+constexpr Price kLevels = 256;
+constexpr std::size_t kEvents = 1000000;
+
+struct Order {
+    Side side;
+    Price price;
+    Quantity quantity;
+};
+
+// Adds, cancels (whole or partial), executes and replaces orders, never resting more than kCapacity
+int RunOrderStore() {
+    OrderStore store(kCapacity);
+    std::vector<Order> model(kEvents * 2);     // by order id
+    std::vector<OrderId> live;
+    live.reserve(kCapacity);
+
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<Price> price(kMid - kLevels / 2, kMid + kLevels / 2 - 1);
+    std::uniform_int_distribution<Quantity> quantity(1, 500);
+    OrderId next_id = 1;
+    std::size_t made = 0;
+    std::size_t mismatches = 0;
+
+    // Applies 'e' (counting only the store's allocations) and checks its level events against the model
+    auto apply = [&](const MarketEvent& e, std::size_t expected, const Order* removed, const Order* added) {
+        OrderStore::LevelEvents out;
+        const std::size_t before = allocations.load(std::memory_order_relaxed);
+        const std::size_t n = store.Apply(e, out);
+        made += allocations.load(std::memory_order_relaxed) - before;
+
+        if (n != expected) {
+            ++mismatches;
+            return;
+        }
+        std::size_t i = 0;
+        if (removed) {
+            const MarketEvent& u = out[i++];
+            if (u.event != LevelEvent::kModifyLevel || u.side != removed->side || u.price != removed->price || u.quantity != removed->quantity) ++mismatches;
+        }
+        if (added) {
+            const MarketEvent& u = out[i++];
+            if (u.event != LevelEvent::kAddLevel || u.side != added->side || u.price != added->price || u.quantity != added->quantity) ++mismatches;
+        }
+    };
+
+    // Half the messages add while below capacity, so the book hovers around full
+    auto step = [&](bool add) {
+        const std::uint64_t r = generator();
+        if (live.empty() || (add && live.size() < kCapacity)) {
+            const Order order{r & 8 ? Side::kBid : Side::kAsk, price(generator), quantity(generator)};
+            const MarketEvent e{1, order.side, LevelEvent::kAddOrder, order.price, order.quantity, 0, next_id, 0};
+            apply(e, 1, nullptr, &order);
+            model[next_id] = order;
+            live.push_back(next_id++);
+            return;
+        }
+
+        const std::size_t slot = static_cast<std::size_t>(generator() % live.size());
+        const OrderId id = live[slot];
+        Order& order = model[id];
+        auto retire = [&] {
+            live[slot] = live.back();
+            live.pop_back();
+        };
+
+        switch (r % 3) {
+            case 0: {
+                // Whole cancel
+                const Order removed = order;
+                apply(MarketEvent{1, order.side, LevelEvent::kCancelOrder, 0, 0, 0, id, 0}, 1, &removed, nullptr);
+                retire();
+                break;
+            }
+            case 1: {
+                // Partial cancel or execution; may fill the order
+                const Quantity q = std::uniform_int_distribution<Quantity>(1, order.quantity)(generator);
+                const LevelEvent event = generator() & 1 ? LevelEvent::kExecuteOrder : LevelEvent::kCancelOrder;
+                const Order removed{order.side, order.price, q};
+                apply(MarketEvent{1, order.side, event, 0, q, 0, id, 0}, 1, &removed, nullptr);
+                order.quantity -= q;
+                if (order.quantity == 0) retire();
+                break;
+            }
+            default: {
+                // Replace with a new id at a new price and quantity
+                const Order removed = order;
+                const Order added{order.side, price(generator), quantity(generator)};
+                apply(MarketEvent{1, order.side, LevelEvent::kReplaceOrder, added.price, added.quantity, 0, id, next_id}, 2, &removed, &added);
+                retire();
+                model[next_id] = added;
+                live.push_back(next_id++);
+                break;
+            }
+        }
+    };
+
+    // Warm-up: fill the book to capacity once, so the node pool holds every node it will need
+    while (live.size() < kCapacity) step(true);
+    for (std::size_t i = 0; i < kEvents / 10; ++i) step(generator() & 1);
+
+    made = 0;
+    for (std::size_t i = 0; i < kEvents; ++i) step(generator() & 1);
+
+    if (store.size() != live.size()) ++mismatches;
+    std::printf("OrderStore: %zu allocations over %zu messages (%zu resting orders), %zu mismatches\n", made, kEvents, store.size(), mismatches);
+    return made == 0 && mismatches == 0 ? 0 : 1;
+}
+
+// Home slot of 'key' in a table of 2^bits slots (OpenHashMap's Fibonacci hashing)
+std::size_t Home(std::uint64_t key, int bits) {
+    return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+}
+
+// Random inserts and erases over keys homed on the last two and first two slots of a 16-slot table,
+// so probe runs collide and wrap; after every operation each key must be found exactly as in the model
+int RunOpenHashErase() {
+    constexpr int kBits = 4;
+    constexpr std::size_t kLive = 8;       // OpenHashMap(8) keeps 16 slots up to 8 keys
+
+    std::vector<std::uint32_t> keys;
+    for (std::uint32_t key = 1; keys.size() < 32; ++key) {
+        const std::size_t home = Home(key, kBits);
+        if (home >= 14 || home <= 1) keys.push_back(key);
+    }
+
+    OpenHashMap<std::uint32_t, std::uint32_t> map(kLive);
+    std::vector<std::int64_t> model(keys.back() + 1, -1);     // by key; -1 = absent
+    std::size_t model_size = 0;
+    std::mt19937_64 generator(7);
+    std::size_t made = 0;
+    std::size_t mismatches = 0;
+
+    for (std::size_t i = 0; i < kEvents; ++i) {
+        const std::uint32_t key = keys[generator() % keys.size()];
+        const std::size_t before = allocations.load(std::memory_order_relaxed);
+        if (model_size < kLive && generator() & 1) {
+            const std::uint32_t value = static_cast<std::uint32_t>(i);
+            if (map.TryEmplace(key, value).second != (model[key] < 0)) ++mismatches;
+            if (model[key] < 0) {
+                model[key] = value;
+                ++model_size;
+            }
+        } else {
+            if (map.Erase(key) != (model[key] >= 0)) ++mismatches;
+            if (model[key] >= 0) {
+                model[key] = -1;
+                --model_size;
+            }
+        }
+        made += allocations.load(std::memory_order_relaxed) - before;
+
+        if (map.size() != model_size) ++mismatches;
+        for (const std::uint32_t k : keys) {
+            const std::uint32_t* value = map.Find(k);
+            if ((value == nullptr) != (model[k] < 0) || (value && *value != model[k])) ++mismatches;
+        }
+    }
+
+    std::printf("OpenHashMap: %zu allocations over %zu colliding operations, %zu mismatches\n", made, kEvents, mismatches);
+    return made == 0 && mismatches == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main() {
+    int failures = 0;
+    failures += RunOrderStore();
+    failures += RunOpenHashErase();
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,105 @@
+#include "seqlock.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/*
+Stress of SeqLockView. One writer publishes views whose every level, and the number of levels on
+each side, is derived from the view's version; readers copy concurrently and must always get a
+view that is exactly one published version, with versions never going backwards.
+*/
+
+namespace {
+
+constexpr Depth kDepth = 16;
+constexpr std::size_t kReaders = 3;
+constexpr std::uint64_t kVersions = 2000000;
+
+struct View {
+    std::uint64_t version = 0;
+    std::vector<PriceLevel> bids;
+    std::vector<PriceLevel> asks;
+};
+
+// Levels of 'version' on one side; the count changes with the version, so a torn count shows too
+void Levels(std::uint64_t version, std::uint64_t salt, std::vector<PriceLevel>& out) {
+    const Depth n = static_cast<Depth>((version * salt) % (kDepth + 1));
+    out.resize(n);
+    for (Depth i = 0; i < n; ++i) {
+        out[i] = PriceLevel{static_cast<Price>(version * 31 + i), static_cast<Quantity>(version ^ (i * salt))};
+    }
+}
+
+bool Valid(const BookSnapshot& snapshot, View& expected) {
+    Levels(snapshot.version, 1, expected.bids);
+    Levels(snapshot.version, 7, expected.asks);
+    auto same = [](const std::vector<PriceLevel>& a, const std::vector<PriceLevel>& b) {
+        if (a.size() != b.size()) return false;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (a[i].price != b[i].price || a[i].quantity != b[i].quantity) return false;
+        }
+        return true;
+    };
+    return same(snapshot.bids, expected.bids) && same(snapshot.asks, expected.asks);
+}
+
+struct ReaderStats {
+    std::uint64_t reads = 0;
+    std::uint64_t invalid = 0;
+    std::uint64_t backwards = 0;
+};
+
+}  // namespace
+
+int main() {
+    SeqLockView<kDepth> published;
+    std::atomic<bool> done{false};
+    std::array<ReaderStats, kReaders> stats{};
+
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&, r] {
+            BookSnapshot snapshot;
+            View expected;
+            std::uint64_t last = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                published.Read(snapshot);
+                if (snapshot.version < last) ++stats[r].backwards;
+                if (!Valid(snapshot, expected)) ++stats[r].invalid;
+                last = snapshot.version;
+                ++stats[r].reads;
+            }
+        });
+    }
+
+    View view;
+    for (std::uint64_t version = 1; version <= kVersions; ++version) {
+        view.version = version;
+        Levels(version, 1, view.bids);
+        Levels(version, 7, view.asks);
+        published.Publish(view);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) reader.join();
+
+    int failures = 0;
+    for (std::size_t r = 0; r < kReaders; ++r) {
+        std::printf("reader %zu: %llu reads, %llu invalid, %llu backwards\n", r, static_cast<unsigned long long>(stats[r].reads),
+                    static_cast<unsigned long long>(stats[r].invalid), static_cast<unsigned long long>(stats[r].backwards));
+        if (stats[r].reads == 0 || stats[r].invalid != 0 || stats[r].backwards != 0) ++failures;
+    }
+
+    // Quiescent: the last publish is read back whole
+    BookSnapshot last;
+    View expected;
+    published.Read(last);
+    if (last.version != kVersions || !Valid(last, expected)) ++failures;
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
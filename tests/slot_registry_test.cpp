@@ -0,0 +1,111 @@
+#include "slot_registry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+Checks that SlotRegistry rejects stale handles. Random claims and erases are checked against a
+model of the live handles, with every erased handle kept and required to stay stale. At the
+largest capacity, every slot but one is held, so that one slot is reused on every claim: the
+worst case for a handle coming back, which must not happen before the generations run out.
+*/
+
+namespace {
+
+using Registry = SlotRegistry<int>;
+
+// Random churn at a small capacity, so slots are reused constantly
+int RunChurn() {
+    constexpr std::size_t kCapacity = 16;
+    constexpr std::size_t kOperations = 200000;
+
+    Registry registry(kCapacity);
+    std::vector<std::pair<std::uint32_t, std::shared_ptr<int>>> live;
+    std::vector<std::uint32_t> erased;
+    std::mt19937_64 generator(11);
+    std::size_t mismatches = 0;
+
+    for (std::size_t i = 0; i < kOperations; ++i) {
+        if (live.size() < kCapacity && (live.empty() || generator() & 1)) {
+            std::uint32_t handle = 0;
+            auto value = registry.Emplace([&](std::uint32_t h) {
+                handle = h;
+                return std::make_shared<int>(static_cast<int>(i));
+            });
+            if (!value || handle == 0) ++mismatches;
+            live.emplace_back(handle, value);
+        } else {
+            const std::size_t slot = static_cast<std::size_t>(generator() % live.size());
+            if (!registry.Erase(live[slot].first)) ++mismatches;
+            erased.push_back(live[slot].first);
+            live[slot] = live.back();
+            live.pop_back();
+        }
+
+        // A full registry refuses the next claim
+        if (live.size() == kCapacity && registry.Emplace([](std::uint32_t) { return std::make_shared<int>(0); })) ++mismatches;
+
+        for (const auto& [handle, value] : live) {
+            if (registry.Find(handle) != value) ++mismatches;
+        }
+        // The most recently erased handles are the ones whose slots were just reused
+        for (std::size_t e = erased.size() > 64 ? erased.size() - 64 : 0; e < erased.size(); ++e) {
+            if (registry.Find(erased[e]) || registry.Erase(erased[e])) ++mismatches;
+        }
+    }
+
+    // Every handle ever erased is still rejected
+    for (const std::uint32_t handle : erased) {
+        if (registry.Find(handle) || registry.Erase(handle)) ++mismatches;
+    }
+
+    std::printf("churn: %zu operations, %zu erased handles, %zu mismatches\n", kOperations, erased.size(), mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
+
+// Largest capacity with a single free slot: every claim reuses it, so a stale handle of that slot
+// must stay rejected through generations() - 1 reuses
+int RunSingleFreeSlot() {
+    Registry registry(Registry::kMaxSlots);
+    const auto value = std::make_shared<int>(0);
+    auto make = [&](std::uint32_t) { return value; };
+
+    std::uint32_t stale = 0;       // the last slot claimed
+    for (std::size_t i = 0; i < registry.capacity(); ++i) {
+        registry.Emplace([&](std::uint32_t h) {
+            stale = h;
+            return value;
+        });
+    }
+
+    std::size_t mismatches = 0;
+    if (registry.Emplace(make)) ++mismatches;
+    if (!registry.Erase(stale)) ++mismatches;
+
+    std::uint32_t handle = 0;
+    for (std::uint32_t reuse = 1; reuse < registry.generations(); ++reuse) {
+        registry.Emplace([&](std::uint32_t h) {
+            handle = h;
+            return value;
+        });
+        if (handle == stale || registry.Find(stale) || registry.Erase(stale)) ++mismatches;
+        if (!registry.Erase(handle)) ++mismatches;
+    }
+
+    std::printf("single free slot: capacity %zu, %u generations, %zu mismatches\n", registry.capacity(), registry.generations(), mismatches);
+    return mismatches == 0 && registry.generations() >= 4095 ? 0 : 1;
+}
+
+}  // namespace
+
+int main() {
+    int failures = 0;
+    failures += RunChurn();
+    failures += RunSingleFreeSlot();
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}